@@ -9,6 +9,7 @@
 
 #include <ipcpp/event/notification.h>
 #include <ipcpp/event/notifier.h>
+#include <ipcpp/event/options.h>
 #include <ipcpp/utils/synchronized.h>
 #include <ipcpp/event/error.h>
 
@@ -18,11 +19,15 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <limits>
+#include <mutex>
 #include <queue>
 #include <set>
 #include <thread>
 #include <expected>
+#include <vector>
 
 namespace ipcpp::event {
 
@@ -33,6 +38,11 @@ using namespace std::chrono_literals;
  * are queued up and observers receive notifications in a FIFO-Queue manner. DomainSocketNotifier::create constructs an
  * instance of DomainSocketNotifier and returns it wrapped by std::expected.
  *
+ * Notifications can be batched (see notifier::BatchOptions): up to max_batch_size notifications are accumulated and
+ * written to each observer with a single send() once the batch is full or max_batch_delay has passed. Observers read
+ * the stream in bulk (see DomainSocketObserver), so at high event rates both sides need one syscall per batch instead
+ * of one per notification.
+ *
  * @attention If you only want observers to receive the latest data consider using ShmPollingNotifier with
  * ShmPollingObserver.
  *
@@ -50,24 +60,35 @@ class DomainSocketNotifier final : Notifier_I<NotificationT> {
   /// Move constructor needed for DomainSocketNotificationHandler::create()
   DomainSocketNotifier(DomainSocketNotifier&& other) noexcept
       : notifier_base(std::move(other)),
-        _max_observers(other._max_observers) {
-    if (other._cancellation_enabled.load()) {
-      _cancellation_enabled.store(true);
-      _request_processing_thread = std::thread(&DomainSocketNotifier::process_observer_requests, this);
-      other._cancellation_enabled.store(false);
-    }
-    if (other._subscription_enabled.load()) {
-      _subscription_enabled.store(true);
-      _subscription_processing_thread = std::thread(&DomainSocketNotifier::process_subscriptions, this);
-      other._subscription_enabled.store(false);
-    }
+        _max_observers(other._max_observers),
+        _batch_options(other._batch_options) {
+    // stop the processing threads of other before its state is moved: they access it
+    const bool cancellation_enabled = other._cancellation_enabled.exchange(false);
+    const bool subscription_enabled = other._subscription_enabled.exchange(false);
     if (other._subscription_processing_thread.joinable()) other._subscription_processing_thread.join();
     if (other._request_processing_thread.joinable()) other._request_processing_thread.join();
 
-    // once the processing threads are done working, we move the _observer_sockets
+    // all state is moved before threads are started on this
     std::swap(_socket, other._socket);
     other._observer_sockets.with_read_lock(
         [&](const std::set<int>& sockets) { _observer_sockets.wlock()->insert(sockets.begin(), sockets.end()); });
+    other._paused_observer_sockets.with_read_lock([&](const std::set<int>& sockets) {
+      _paused_observer_sockets.wlock()->insert(sockets.begin(), sockets.end());
+    });
+    {
+      std::scoped_lock lock(_batch_mutex, other._batch_mutex);
+      _batch = std::move(other._batch);
+      _batch_start = other._batch_start;
+    }
+
+    if (cancellation_enabled) {
+      _cancellation_enabled.store(true);
+      _request_processing_thread = std::thread(&DomainSocketNotifier::process_observer_requests, this);
+    }
+    if (subscription_enabled) {
+      _subscription_enabled.store(true);
+      _subscription_processing_thread = std::thread(&DomainSocketNotifier::process_subscriptions, this);
+    }
   }
 
   /// Delete copy constructor
@@ -86,11 +107,13 @@ class DomainSocketNotifier final : Notifier_I<NotificationT> {
    *
    * @param id socket path
    * @param max_num_observers maximum number of observers
+   * @param batch_options batching of notifications, disabled by default
    * @return instance wrapped by std::expected
    */
   static std::expected<DomainSocketNotifier, std::error_code> create(
-      std::string&& id, std::uint16_t max_num_observers = std::numeric_limits<uint16_t>::max()) {
-    DomainSocketNotifier self(std::move(id), max_num_observers);
+      std::string&& id, std::uint16_t max_num_observers = std::numeric_limits<uint16_t>::max(),
+      const notifier::BatchOptions& batch_options = {}) {
+    DomainSocketNotifier self(std::move(id), max_num_observers, batch_options);
     if (auto result = self.setup_socket(); !result.has_value()) {
       return std::unexpected(result.error());
     }
@@ -103,6 +126,7 @@ class DomainSocketNotifier final : Notifier_I<NotificationT> {
    */
   void shutdown() {
     // TODO: send unsubscription messages to all observers
+    flush();
     _subscription_enabled.store(false);
     _cancellation_enabled.store(false);
     ::shutdown(_socket, SHUT_RDWR);
@@ -111,25 +135,36 @@ class DomainSocketNotifier final : Notifier_I<NotificationT> {
   }
 
   /**
-   * @brief Broadcasts notification to all subscribed observers
+   * @brief Broadcasts notification to all subscribed observers. If batching is enabled, the notification is appended
+   *  to the pending batch which is sent once it is full (or max_batch_delay has passed, see flush()).
    * @param notification
    */
   void notify_observers(typename notifier_base::notification_type notification) override {
-    _observer_sockets.with_write_lock([&notification](auto& sockets) {
-      auto it = sockets.begin();
-      while (it != sockets.end()) {
-        int observer_socket = *it;
+    if (_batch_options.max_batch_size <= 1) {
+      _m_send_to_observers(&notification, sizeof(notification));
+      return;
+    }
+    std::unique_lock lock(_batch_mutex);
+    const bool first = _batch.empty();
+    if (first) {
+      _batch_start = std::chrono::steady_clock::now();
+    }
+    const auto* bytes = reinterpret_cast<const std::byte*>(&notification);
+    _batch.insert(_batch.end(), bytes, bytes + sizeof(notification));
+    if (_batch.size() >= _batch_options.max_batch_size * sizeof(notification)) {
+      _m_flush_batch();
+    } else if (first) {
+      // arms the max_batch_delay timeout of the request processing thread
+      _batch_cv.notify_one();
+    }
+  }
 
-        if (send(observer_socket, &notification, sizeof(notification), MSG_NOSIGNAL) == -1) {
-          if (errno == ECONNRESET || errno == EPIPE) {
-            close(observer_socket);
-            it = sockets.erase(it);
-            continue;
-          }
-        }
-        ++it;
-      }
-    });
+  /**
+   * @brief Sends all pending batched notifications to the observers immediately.
+   */
+  void flush() {
+    std::unique_lock lock(_batch_mutex);
+    _m_flush_batch();
   }
 
   /**
@@ -164,8 +199,77 @@ class DomainSocketNotifier final : Notifier_I<NotificationT> {
 
  private:
   /// Constructor only used by DomainSocketNotifier::create()
-  explicit DomainSocketNotifier(std::string&& id, const uint16_t max_num_observers)
-      : _id("/tmp/" + std::move(id) + ".ipcpp.sock"), _max_observers(max_num_observers) {}
+  explicit DomainSocketNotifier(std::string&& id, const uint16_t max_num_observers,
+                                const notifier::BatchOptions& batch_options)
+      : _id("/tmp/" + std::move(id) + ".ipcpp.sock"),
+        _max_observers(max_num_observers),
+        _batch_options(batch_options) {
+    if (_batch_options.max_batch_size > 1) {
+      _batch.reserve(_batch_options.max_batch_size * sizeof(typename notifier_base::notification_type));
+    }
+  }
+
+  /**
+   * @brief Write size bytes of data to every subscribed observer. Observers whose connection was reset are removed.
+   */
+  void _m_send_to_observers(const void* data, const std::size_t size) {
+    _observer_sockets.with_write_lock([data, size](auto& sockets) {
+      auto it = sockets.begin();
+      while (it != sockets.end()) {
+        int observer_socket = *it;
+
+        std::size_t sent = 0;
+        while (sent < size) {
+          const ssize_t result =
+              send(observer_socket, static_cast<const std::byte*>(data) + sent, size - sent, MSG_NOSIGNAL);
+          if (result == -1) {
+            if (errno == EINTR) {
+              continue;
+            }
+            break;
+          }
+          sent += static_cast<std::size_t>(result);
+        }
+        if (sent < size && (errno == ECONNRESET || errno == EPIPE)) {
+          close(observer_socket);
+          it = sockets.erase(it);
+          continue;
+        }
+        ++it;
+      }
+    });
+  }
+
+  /// Send the pending batch. _batch_mutex must be held.
+  void _m_flush_batch() {
+    if (_batch.empty()) {
+      return;
+    }
+    _m_send_to_observers(_batch.data(), _batch.size());
+    _batch.clear();
+  }
+
+  /**
+   * @brief Wait for at most request_poll_interval and flush the pending batch once its oldest notification is older
+   *  than max_batch_delay. An empty batch has no deadline: the wait only ends early if the first notification is
+   *  queued, so an idle notifier does not wake up more often than without batching.
+   */
+  void _m_flush_batch_when_due() {
+    const auto poll_deadline = std::chrono::steady_clock::now() + request_poll_interval;
+    if (_batch_options.max_batch_size <= 1) {
+      std::this_thread::sleep_until(poll_deadline);
+      return;
+    }
+    std::unique_lock lock(_batch_mutex);
+    if (!_batch_cv.wait_until(lock, poll_deadline, [this]() { return !_batch.empty(); })) {
+      return;
+    }
+    // a batch is pending: wait for its deadline, but still return in time to process observer requests
+    _batch_cv.wait_until(lock, std::min(poll_deadline, _batch_start + _batch_options.max_batch_delay));
+    if (!_batch.empty() && std::chrono::steady_clock::now() - _batch_start >= _batch_options.max_batch_delay) {
+      _m_flush_batch();
+    }
+  }
 
   /**
    * @brief Set up the subscription request socket
@@ -270,15 +374,20 @@ class DomainSocketNotifier final : Notifier_I<NotificationT> {
           }
         }
       });
-      std::this_thread::sleep_for(10ms);
+      _m_flush_batch_when_due();
     }
   }
 
  private:
+  /// interval in which observer requests (e.g. cancellations) are processed
+  static constexpr std::chrono::milliseconds request_poll_interval = 10ms;
+
   /// socket name
   std::string _id;
   /// maximum number of concurrently subscribed observers
   const uint16_t _max_observers;
+  /// batching configuration, batching is disabled if max_batch_size <= 1
+  const notifier::BatchOptions _batch_options;
   /// main socket receiving subscription requests
   int _socket = -1;
   /// file descriptors of subscribed observers
@@ -289,6 +398,13 @@ class DomainSocketNotifier final : Notifier_I<NotificationT> {
   std::atomic_bool _cancellation_enabled = false;
   std::thread _subscription_processing_thread;
   std::thread _request_processing_thread;
+
+  /// pending (not yet sent) notifications, guarded by _batch_mutex
+  std::mutex _batch_mutex;
+  /// signalled when the first notification of a batch is queued
+  std::condition_variable _batch_cv;
+  std::vector<std::byte> _batch;
+  std::chrono::steady_clock::time_point _batch_start;
 };
 
 }  // namespace ipcpp::event
\ No newline at end of file
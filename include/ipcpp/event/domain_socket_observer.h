@@ -7,27 +7,48 @@
 
 #pragma once
 
+#include <ipcpp/event/error.h>
 #include <ipcpp/event/notification.h>
 #include <ipcpp/event/observer.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cerrno>
 #include <chrono>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace ipcpp::event {
 
 using namespace std::chrono_literals;
 
+/**
+ * @brief DomainSocketObserver implements Observer_I for notifications sent by a DomainSocketNotifier.
+ *
+ * Notifications are read in bulk: a single recv() fills an internal buffer with up to max_batch_size notifications
+ * which are then handed out by subsequent receive() calls without further syscalls. This matches the batched send
+ * path of DomainSocketNotifier.
+ *
+ * @tparam NotificationT trivially copyable notification type, must match the notifiers NotificationT
+ */
 template <typename NotificationT>
+  requires std::is_trivially_copyable_v<NotificationT>
 class DomainSocketObserver final : public Observer_I<NotificationT> {
  public:
   typedef Observer_I<NotificationT> observer_base;
 
  public:
-  /// Move constructor needed for DomainSocketNotificationHandler::create()
+  /// Move constructor needed for DomainSocketObserver::create()
   DomainSocketObserver(DomainSocketObserver&& other) noexcept
-      : observer_base(std::move(other)), _id(std::move(other._id)) {
+      : observer_base(std::move(other)),
+        _id(std::move(other._id)),
+        _buffer(std::move(other._buffer)),
+        _buffer_begin(std::exchange(other._buffer_begin, 0)),
+        _buffer_end(std::exchange(other._buffer_end, 0)) {
     std::swap(_socket, other._socket);
   }
 
@@ -37,114 +58,110 @@ class DomainSocketObserver final : public Observer_I<NotificationT> {
   ~DomainSocketObserver() override {
     if (_socket != -1) {
       if (observer_base::is_subscribed()) {
-        DomainSocketObserver::cancel_subscription().or_else(
-            [](auto error) -> std::expected<void, std::error_code> {
-              return {};
-            });
+        DomainSocketObserver::cancel_subscription();
       }
-      ::shutdown(_socket, SHUT_RDWR);
-      close(_socket);
+      _m_close_socket();
     }
   }
 
-  static std::expected<DomainSocketObserver, std::error_code> create(std::string&& id) {
-    DomainSocketObserver self(std::move(id));
+  /**
+   * @brief Create an observer for the DomainSocketNotifier identified by id.
+   *
+   * @param id notifier id (the same id that was passed to DomainSocketNotifier::create())
+   * @param max_batch_size maximum number of notifications read by a single recv() call
+   * @return instance wrapped by std::expected
+   */
+  static std::expected<DomainSocketObserver, std::error_code> create(std::string&& id,
+                                                                     std::size_t max_batch_size = 1) {
+    DomainSocketObserver self(std::move(id), std::max<std::size_t>(max_batch_size, 1));
     return self;
   }
 
-  std::expected<bool, std::error_code> subscribe() override {
+  std::error_code subscribe() override {
     if (observer_base::is_subscription_paused()) {
-      ::shutdown(_socket, SHUT_RDWR);
-      close(_socket);
-      _socket = -1;
+      _m_close_socket();
+      observer_base::_subscription_paused = false;
     }
 
-    if (!_m_setup_socket().has_value()) {
-      return std::unexpected(SubscriptionError::OBSERVER_SETUP_FAILED);
+    if (!_m_setup_socket()) {
+      return {static_cast<int>(error_t::subscription_failed), error_category()};
     }
 
-    bool response;
-    if (recv(_socket, &response, sizeof(response), 0) == -1) {
-      return std::unexpected(SubscriptionError::NOTIFIER_UNREACHABLE);
+    bool response = false;
+    if (recv(_socket, &response, sizeof(response), 0) != sizeof(response)) {
+      return {static_cast<int>(error_t::notifier_down), error_category()};
     }
 
-    if (response) {
-      observer_base::_subscribed = true;
-      return true;
+    if (!response) {
+      return {static_cast<int>(error_t::subscription_failed), error_category()};
     }
-    return std::unexpected(response.info);
+    observer_base::_subscribed = true;
+    return {};
   }
 
-  std::expected<void, SubscriptionError> cancel_subscription() override {
+  std::error_code cancel_subscription() override {
     if (!observer_base::is_subscribed()) {
-      return std::unexpected(SubscriptionError::OBSERVER_NOT_SUBSCRIBED);
-    }
-    if (observer_base::is_subscription_paused()) {
-      ::shutdown(_socket, SHUT_RDWR);
-      close(_socket);
-      _socket = -1;
-      return {};
+      return {static_cast<int>(error_t::not_subscribed), error_category()};
     }
 
     constexpr auto request = ObserverRequest::CANCEL_SUBSCRIPTION;
-    if (send(_socket, &request, sizeof(request), 0) == -1) {
-      return std::unexpected(SubscriptionError::NOTIFIER_UNREACHABLE);
-    }
-
-    auto response = SubscriptionError::UNKNOWN;
-    if (recv(_socket, &response, sizeof(response), 0) == -1) {
-      return std::unexpected(SubscriptionError::NOTIFIER_UNREACHABLE);
-    }
-
-    if (response == SubscriptionError::NO_ERROR) {
-      ::shutdown(_socket, SHUT_RDWR);
-      close(_socket);
-      _socket = -1;
-      return {};
+    const bool sent = send(_socket, &request, sizeof(request), MSG_NOSIGNAL) != -1;
+    _m_close_socket();
+    observer_base::_subscribed = false;
+    observer_base::_subscription_paused = false;
+    if (!sent) {
+      return {static_cast<int>(error_t::notifier_down), error_category()};
     }
-
-    return std::unexpected(response);
+    return {};
   }
 
-  std::expected<void, SubscriptionError> pause_subscription() override {
+  std::expected<void, std::error_code> pause_subscription() override {
     if (!observer_base::is_subscribed()) {
-      return std::unexpected(SubscriptionError::OBSERVER_NOT_SUBSCRIBED);
+      return std::unexpected(std::error_code(static_cast<int>(error_t::not_subscribed), error_category()));
     }
     if (observer_base::is_subscription_paused()) {
       return {};
     }
 
     constexpr auto request = ObserverRequest::PAUSE_SUBSCRIPTION;
-    if (send(_socket, &request, sizeof(request), 0) == -1) {
-      return std::unexpected(SubscriptionError::NOTIFIER_UNREACHABLE);
+    if (send(_socket, &request, sizeof(request), MSG_NOSIGNAL) == -1) {
+      return std::unexpected(std::error_code(static_cast<int>(error_t::notifier_down), error_category()));
     }
+    observer_base::_subscription_paused = true;
 
     return {};
   }
 
-  std::expected<void, SubscriptionError> resume_subscription() override {
+  std::expected<void, std::error_code> resume_subscription() override {
     if (!observer_base::is_subscribed()) {
-      return std::unexpected(SubscriptionError::OBSERVER_NOT_SUBSCRIBED);
+      return std::unexpected(std::error_code(static_cast<int>(error_t::not_subscribed), error_category()));
     }
-    if (observer_base::is_subscription_paused()) {
+    if (!observer_base::is_subscription_paused()) {
       return {};
     }
 
     constexpr auto request = ObserverRequest::RESUME_SUBSCRIPTION;
-    if (send(_socket, &request, sizeof(request), 0) == -1) {
-      return std::unexpected(SubscriptionError::NOTIFIER_UNREACHABLE);
+    if (send(_socket, &request, sizeof(request), MSG_NOSIGNAL) == -1) {
+      return std::unexpected(std::error_code(static_cast<int>(error_t::notifier_down), error_category()));
     }
+    observer_base::_subscription_paused = false;
 
     return {};
   }
 
+  /// number of notifications already received from the socket but not yet handed out by receive()
+  [[nodiscard]] std::size_t num_buffered_notifications() const noexcept {
+    return (_buffer_end - _buffer_begin) / sizeof(NotificationT);
+  }
+
  private:
-  explicit DomainSocketObserver(std::string&& id) : _id(std::move(id)) {}
+  explicit DomainSocketObserver(std::string&& id, const std::size_t max_batch_size)
+      : _id("/tmp/" + std::move(id) + ".ipcpp.sock"), _buffer(max_batch_size * sizeof(NotificationT)) {}
 
-  std::expected<void, create_error_type> _m_setup_socket() {
+  bool _m_setup_socket() {
     _socket = socket(AF_UNIX, SOCK_STREAM, 0);
     if (_socket == -1) {
-      return std::unexpected(create_error_type::CREATION_ERROR);
+      return false;
     }
 
     sockaddr_un server_addr{};
@@ -152,45 +169,82 @@ class DomainSocketObserver final : public Observer_I<NotificationT> {
     strncpy(server_addr.sun_path, _id.c_str(), sizeof(server_addr.sun_path) - 1);
 
     if (connect(_socket, reinterpret_cast<sockaddr*>(&server_addr), sizeof(server_addr)) == -1) {
-      return std::unexpected(create_error_type::CONNECTION_ERROR);
+      _m_close_socket();
+      return false;
+    }
+
+    return true;
+  }
+
+  void _m_close_socket() {
+    if (_socket != -1) {
+      ::shutdown(_socket, SHUT_RDWR);
+      close(_socket);
+      _socket = -1;
     }
+    _buffer_begin = _buffer_end = 0;
+  }
 
+  /**
+   * @brief Read as many bytes as currently available (up to the buffer capacity) until at least one complete
+   *  notification is buffered. Bytes of a partially received notification are kept at the front of the buffer.
+   */
+  std::error_code _m_fill_buffer() {
+    if (_buffer_begin > 0) {
+      std::memmove(_buffer.data(), _buffer.data() + _buffer_begin, _buffer_end - _buffer_begin);
+      _buffer_end -= _buffer_begin;
+      _buffer_begin = 0;
+    }
+    while (_buffer_end < sizeof(NotificationT)) {
+      const ssize_t result = recv(_socket, _buffer.data() + _buffer_end, _buffer.size() - _buffer_end, 0);
+      if (result == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+          return {static_cast<int>(error_t::timeout), error_category()};
+        }
+        return {static_cast<int>(error_t::unknown_error), error_category()};
+      }
+      if (result == 0) {
+        return {static_cast<int>(error_t::notifier_down), error_category()};
+      }
+      _buffer_end += static_cast<std::size_t>(result);
+    }
     return {};
   }
 
-  std::expected<std::any, typename observer_base::notification_error_type> _m_receive_helper(
+  std::expected<std::any, std::error_code> _m_receive_helper(
       const std::function<std::any(typename observer_base::notification_type)>& callback,
       const std::chrono::milliseconds timeout) override {
-    typename observer_base::notification_type notification;
+    if (num_buffered_notifications() == 0) {
+      // Save the current timeout for restoring at the end of this function
+      timeval original_timeout{};
+      if (timeout.count() > 0) {
+        socklen_t len = sizeof(original_timeout);
+        getsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &original_timeout, &len);
+
+        // Set the new timeout
+        const timeval new_timeout = {timeout.count() / 1000, (timeout.count() % 1000) * 1000};
+        if (setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &new_timeout, sizeof(new_timeout)) < 0) {
+          return std::unexpected(std::error_code(static_cast<int>(error_t::unknown_error), error_category()));
+        }
+      }
 
-    // Save the current timeout for restoring at the end of this function
-    timeval original_timeout{};
-    if (timeout.count() > 0) {
-      socklen_t len = sizeof(original_timeout);
-      getsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &original_timeout, &len);
+      const std::error_code error = _m_fill_buffer();
 
-      // Set the new timeout
-      const timeval new_timeout = {timeout.count() / 1000, (timeout.count() % 1000) * 1000};
-      if (setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &new_timeout, sizeof(new_timeout)) < 0) {
-        return std::unexpected(NotificationError::TIMEOUT_SETUP_ERROR);
+      if (timeout.count() > 0) {
+        // Restore the original timeout
+        setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &original_timeout, sizeof(original_timeout));
       }
-    }
-
-    auto result = recv(_socket, &notification, sizeof(notification), 0);
-    if (result == -1) {
-      if (errno == EAGAIN || errno == EWOULDBLOCK) {
-        return std::unexpected(NotificationError::TIMEOUT);
+      if (error) {
+        return std::unexpected(error);
       }
-      return std::unexpected(NotificationError::NOTIFICATION_ERROR);
-    }
-    if (result == 0) {
-      return std::unexpected(NotificationError::NOTIFIER_DOWN);
     }
 
-    if (timeout.count() > 0) {
-      // Restore the original timeout
-      setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &original_timeout, sizeof(original_timeout));
-    }
+    typename observer_base::notification_type notification;
+    std::memcpy(&notification, _buffer.data() + _buffer_begin, sizeof(notification));
+    _buffer_begin += sizeof(notification);
 
     return callback(notification);
   }
@@ -200,6 +254,10 @@ class DomainSocketObserver final : public Observer_I<NotificationT> {
   std::string _id;
   /// file-descriptor, this client is reading from
   int _socket = -1;
+  /// bytes received from _socket but not yet handed out: [_buffer_begin, _buffer_end)
+  std::vector<std::byte> _buffer;
+  std::size_t _buffer_begin = 0;
+  std::size_t _buffer_end = 0;
 };
 
 }  // namespace ipcpp::event
\ No newline at end of file
@@ -0,0 +1,321 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/event/epoll_reactor.h>
+#include <ipcpp/event/error.h>
+#include <ipcpp/event/notification.h>
+#include <ipcpp/event/notifier.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstring>
+#include <expected>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ipcpp::event {
+
+/**
+ * @brief Notifier_I implementation using unix domain sockets (AF_UNIX, SOCK_STREAM) like DomainSocketNotifier, but
+ *  driven by an EpollReactor instead of two processing threads per notifier:
+ *   - all sockets are non-blocking: notify_observers never waits for a slow observer
+ *   - notifications an observer can not take right now are queued per observer and flushed by the reactor with a
+ *     single send() once the socket is writable again
+ *   - at most max_pending_notifications are queued per observer, older ones are dropped (coalesced) so that slow
+ *     observers receive the latest notifications
+ *
+ *  Observers use the protocol of DomainSocketObserver.
+ *
+ * @implements Notifier_I
+ */
+template <typename NotificationT>
+  requires std::is_trivially_copyable_v<NotificationT>
+class EpollDomainSocketNotifier final : public Notifier_I<NotificationT> {
+ public:
+  typedef Notifier_I<NotificationT> notifier_base;
+  typedef typename notifier_base::notification_type notification_type;
+
+ private:
+  struct ObserverConnection {
+    /// bytes not yet sent: the remainder of a partially sent notification followed by whole notifications
+    std::vector<std::byte> pending;
+    bool paused = false;
+  };
+
+  /// shared with the handlers running on the reactor thread, outlives the notifier if a handler is still running
+  struct State {
+    std::mutex mutex;
+    std::string socket_path;
+    int socket = -1;
+    std::size_t max_observers = 0;
+    std::size_t max_pending_bytes = 0;
+    bool accepting = false;
+    std::unordered_map<int, ObserverConnection> observers;
+    /// handlers only run while the reactor is alive (it joins its thread on destruction)
+    EpollReactor* reactor = nullptr;
+  };
+
+ public:
+  EpollDomainSocketNotifier(EpollDomainSocketNotifier&&) noexcept = default;
+  EpollDomainSocketNotifier(const EpollDomainSocketNotifier&) = delete;
+
+  ~EpollDomainSocketNotifier() override {
+    if (_state) {
+      shutdown();
+    }
+  }
+
+  /**
+   * @brief Create an EpollDomainSocketNotifier listening on /tmp/<id>.ipcpp.sock.
+   *
+   * @param id socket name
+   * @param max_num_observers maximum number of observers
+   * @param max_pending_notifications maximum number of notifications queued for an observer that does not read
+   * @param reactor event loop serving this notifier, defaults to EpollReactor::shared()
+   */
+  static std::expected<EpollDomainSocketNotifier, std::error_code> create(
+      std::string&& id, std::uint16_t max_num_observers = std::numeric_limits<uint16_t>::max(),
+      std::size_t max_pending_notifications = 64, std::shared_ptr<EpollReactor> reactor = nullptr) {
+    if (!reactor) {
+      auto e_reactor = EpollReactor::shared();
+      if (!e_reactor) {
+        return std::unexpected(e_reactor.error());
+      }
+      reactor = std::move(e_reactor.value());
+    }
+    EpollDomainSocketNotifier self(std::move(id), std::move(reactor));
+    self._state->max_observers = max_num_observers;
+    self._state->max_pending_bytes = max_pending_notifications * sizeof(notification_type);
+    if (auto error = self._m_setup_socket(); error) {
+      return std::unexpected(error);
+    }
+    return self;
+  }
+
+  /**
+   * @brief Unregister all sockets from the reactor and close them.
+   */
+  void shutdown() {
+    std::lock_guard lock(_state->mutex);
+    if (_state->socket == -1) {
+      return;
+    }
+    if (_state->accepting) {
+      _reactor->remove(_state->socket);
+    }
+    for (auto& [fd, observer] : _state->observers) {
+      _reactor->remove(fd);
+      close(fd);
+    }
+    _state->observers.clear();
+    close(_state->socket);
+    unlink(_state->socket_path.c_str());
+    _state->socket = -1;
+  }
+
+  /**
+   * @brief Broadcast notification to all subscribed observers without blocking.
+   */
+  void notify_observers(notification_type notification) override {
+    const auto* bytes = reinterpret_cast<const std::byte*>(&notification);
+    std::lock_guard lock(_state->mutex);
+    for (auto it = _state->observers.begin(); it != _state->observers.end();) {
+      auto& [fd, observer] = *it;
+      if (observer.paused) {
+        ++it;
+        continue;
+      }
+      std::size_t sent = 0;
+      if (observer.pending.empty()) {
+        // fast path: the socket buffer takes the notification right away
+        const ssize_t result = send(fd, bytes, sizeof(notification), MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (result == sizeof(notification)) {
+          ++it;
+          continue;
+        }
+        if (result == -1 && errno != EAGAIN && errno != EWOULDBLOCK) {
+          it = _m_close_observer(*_state, _reactor.get(), it);
+          continue;
+        }
+        sent = result > 0 ? static_cast<std::size_t>(result) : 0;
+        _reactor->modify(fd, EPOLLIN | EPOLLOUT);
+      } else if (observer.pending.size() + sizeof(notification) > _state->max_pending_bytes) {
+        // coalesce: drop the oldest whole notification (a partially sent one must be completed)
+        const std::size_t partial = observer.pending.size() % sizeof(notification);
+        if (observer.pending.size() >= partial + sizeof(notification)) {
+          observer.pending.erase(observer.pending.begin() + partial,
+                                 observer.pending.begin() + partial + sizeof(notification));
+        }
+      }
+      observer.pending.insert(observer.pending.end(), bytes + sent, bytes + sizeof(notification));
+      ++it;
+    }
+  }
+
+  void accept_subscriptions() override {
+    std::lock_guard lock(_state->mutex);
+    if (_state->accepting || _state->socket == -1) {
+      return;
+    }
+    if (!_reactor->add(_state->socket, EPOLLIN,
+                       [weak_state = std::weak_ptr<State>(_state)](std::uint32_t) {
+                         if (auto state = weak_state.lock(); state) {
+                           _m_handle_subscriptions(state);
+                         }
+                       })) {
+      _state->accepting = true;
+    }
+  }
+
+  void reject_subscriptions() override {
+    std::lock_guard lock(_state->mutex);
+    if (!_state->accepting) {
+      return;
+    }
+    _reactor->remove(_state->socket);
+    _state->accepting = false;
+  }
+
+  [[nodiscard]] std::size_t num_observers() const override {
+    std::lock_guard lock(_state->mutex);
+    return _state->observers.size();
+  }
+
+ private:
+  EpollDomainSocketNotifier(std::string&& id, std::shared_ptr<EpollReactor>&& reactor)
+      : _state(std::make_shared<State>()), _reactor(std::move(reactor)) {
+    _state->socket_path = "/tmp/" + std::move(id) + ".ipcpp.sock";
+    _state->reactor = _reactor.get();
+    notifier_base::_id = _state->socket_path;
+  }
+
+  std::error_code _m_setup_socket() {
+    _state->socket = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (_state->socket == -1) {
+      return {static_cast<int>(socket_error_t::create_error), socket_error_category()};
+    }
+
+    sockaddr_un server_addr{};
+    server_addr.sun_family = AF_UNIX;
+    strncpy(server_addr.sun_path, _state->socket_path.c_str(), sizeof(server_addr.sun_path) - 1);
+    unlink(_state->socket_path.c_str());
+
+    if (bind(_state->socket, reinterpret_cast<sockaddr*>(&server_addr), sizeof(server_addr)) == -1) {
+      return {static_cast<int>(socket_error_t::bind_error), socket_error_category()};
+    }
+    if (listen(_state->socket, static_cast<int>(_state->max_observers)) == -1) {
+      return {static_cast<int>(socket_error_t::listen_error), socket_error_category()};
+    }
+    return {};
+  }
+
+  static auto _m_close_observer(State& state, EpollReactor* reactor,
+                                typename std::unordered_map<int, ObserverConnection>::iterator it) {
+    reactor->remove(it->first);
+    close(it->first);
+    return state.observers.erase(it);
+  }
+
+  /// reactor thread: accept all pending subscriptions of the listening socket
+  static void _m_handle_subscriptions(const std::shared_ptr<State>& state) {
+    EpollReactor* reactor = state->reactor;
+    std::lock_guard lock(state->mutex);
+    while (true) {
+      const int client_fd = accept4(state->socket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (client_fd == -1) {
+        return;
+      }
+      if (state->observers.size() >= state->max_observers) {
+        close(client_fd);
+        continue;
+      }
+      bool response = true;
+      send(client_fd, &response, sizeof(response), MSG_NOSIGNAL);
+      state->observers.emplace(client_fd, ObserverConnection{});
+      reactor->add(client_fd, EPOLLIN, [weak_state = std::weak_ptr<State>(state), client_fd](std::uint32_t events) {
+        if (auto locked_state = weak_state.lock(); locked_state) {
+          _m_handle_observer(locked_state, client_fd, events);
+        }
+      });
+    }
+  }
+
+  /// reactor thread: flush pending notifications and process observer requests
+  static void _m_handle_observer(const std::shared_ptr<State>& state, int fd, std::uint32_t events) {
+    EpollReactor* reactor = state->reactor;
+    std::lock_guard lock(state->mutex);
+    auto it = state->observers.find(fd);
+    if (it == state->observers.end()) {
+      return;
+    }
+    ObserverConnection& observer = it->second;
+    if (events & (EPOLLHUP | EPOLLERR)) {
+      _m_close_observer(*state, reactor, it);
+      return;
+    }
+    if ((events & EPOLLOUT) && !observer.pending.empty()) {
+      // all coalesced notifications are flushed with one syscall
+      const ssize_t result = send(fd, observer.pending.data(), observer.pending.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+      if (result == -1 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        _m_close_observer(*state, reactor, it);
+        return;
+      }
+      if (result > 0) {
+        observer.pending.erase(observer.pending.begin(), observer.pending.begin() + result);
+      }
+      if (observer.pending.empty()) {
+        reactor->modify(fd, EPOLLIN);
+      }
+    }
+    if (events & EPOLLIN) {
+      ObserverRequest request;
+      while (true) {
+        const ssize_t bytes = recv(fd, &request, sizeof(request), MSG_DONTWAIT);
+        if (bytes == 0) {
+          _m_close_observer(*state, reactor, it);
+          return;
+        }
+        if (bytes != sizeof(request)) {
+          return;
+        }
+        switch (request) {
+          case ObserverRequest::SUBSCRIBE:
+            break;
+          case ObserverRequest::CANCEL_SUBSCRIPTION:
+            _m_close_observer(*state, reactor, it);
+            return;
+          case ObserverRequest::PAUSE_SUBSCRIPTION:
+            observer.paused = true;
+            // only a partially sent notification must still be completed
+            observer.pending.resize(observer.pending.size() % sizeof(notification_type));
+            if (observer.pending.empty()) {
+              reactor->modify(fd, EPOLLIN);
+            }
+            break;
+          case ObserverRequest::RESUME_SUBSCRIPTION:
+            observer.paused = false;
+            break;
+        }
+      }
+    }
+  }
+
+ private:
+  std::shared_ptr<State> _state;
+  std::shared_ptr<EpollReactor> _reactor;
+};
+
+}  // namespace ipcpp::event
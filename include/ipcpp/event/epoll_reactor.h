@@ -0,0 +1,174 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+
+namespace ipcpp::event {
+
+/**
+ * @brief Single threaded epoll event loop. File descriptors of any number of notifiers (e.g. EpollDomainSocketNotifier)
+ *  are registered with a handler that is invoked on the reactor thread whenever the fd is ready. Handlers must not
+ *  block: all registered fds are expected to be non-blocking.
+ *
+ * @attention handlers must not own the reactor: the last reference must not be dropped on the reactor thread.
+ */
+class EpollReactor {
+ public:
+  typedef std::function<void(std::uint32_t /*epoll events*/)> handler_type;
+
+ public:
+  static std::expected<std::shared_ptr<EpollReactor>, std::error_code> create() {
+    const int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd == -1) {
+      return std::unexpected(std::error_code(errno, std::system_category()));
+    }
+    const int wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_fd == -1) {
+      const int error = errno;
+      close(epoll_fd);
+      return std::unexpected(std::error_code(error, std::system_category()));
+    }
+    epoll_event event{.events = EPOLLIN, .data = {.fd = wake_fd}};
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &event) == -1) {
+      const int error = errno;
+      close(wake_fd);
+      close(epoll_fd);
+      return std::unexpected(std::error_code(error, std::system_category()));
+    }
+    std::shared_ptr<EpollReactor> self(new EpollReactor(epoll_fd, wake_fd));
+    self->_thread = std::thread(&EpollReactor::_m_run, self.get());
+    return self;
+  }
+
+  /**
+   * @brief Process wide reactor shared by all notifiers that are not given a dedicated one.
+   */
+  static std::expected<std::shared_ptr<EpollReactor>, std::error_code> shared() {
+    static std::mutex mutex;
+    static std::weak_ptr<EpollReactor> instance;
+    std::lock_guard lock(mutex);
+    if (auto reactor = instance.lock(); reactor) {
+      return reactor;
+    }
+    auto e_reactor = create();
+    if (e_reactor) {
+      instance = e_reactor.value();
+    }
+    return e_reactor;
+  }
+
+  EpollReactor(const EpollReactor&) = delete;
+  EpollReactor& operator=(const EpollReactor&) = delete;
+
+  ~EpollReactor() {
+    _running.store(false, std::memory_order_release);
+    const std::uint64_t value = 1;
+    [[maybe_unused]] auto _ = write(_wake_fd, &value, sizeof(value));
+    if (_thread.joinable()) {
+      _thread.join();
+    }
+    close(_wake_fd);
+    close(_epoll_fd);
+  }
+
+ public:
+  /**
+   * @brief Register fd with handler.
+   * @return EEXIST if fd is already registered (the registered handler is kept), other epoll_ctl errors
+   */
+  std::error_code add(int fd, std::uint32_t events, handler_type handler) {
+    {
+      std::lock_guard lock(_handlers_mutex);
+      if (!_handlers.try_emplace(fd, std::make_shared<handler_type>(std::move(handler))).second) {
+        return {EEXIST, std::system_category()};
+      }
+    }
+    epoll_event event{.events = events, .data = {.fd = fd}};
+    if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1) {
+      const int error = errno;
+      std::lock_guard lock(_handlers_mutex);
+      _handlers.erase(fd);
+      return {error, std::system_category()};
+    }
+    return {};
+  }
+
+  std::error_code modify(int fd, std::uint32_t events) {
+    epoll_event event{.events = events, .data = {.fd = fd}};
+    if (epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, fd, &event) == -1) {
+      return {errno, std::system_category()};
+    }
+    return {};
+  }
+
+  /**
+   * @brief Unregister fd. A handler of fd that is currently running on the reactor thread completes.
+   */
+  void remove(int fd) {
+    epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+    std::lock_guard lock(_handlers_mutex);
+    _handlers.erase(fd);
+  }
+
+ private:
+  EpollReactor(int epoll_fd, int wake_fd) : _epoll_fd(epoll_fd), _wake_fd(wake_fd) {}
+
+  void _m_run() {
+    std::array<epoll_event, 64> events{};
+    while (_running.load(std::memory_order_acquire)) {
+      const int num_events = epoll_wait(_epoll_fd, events.data(), static_cast<int>(events.size()), -1);
+      if (num_events == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return;
+      }
+      for (int i = 0; i < num_events; ++i) {
+        if (events[i].data.fd == _wake_fd) {
+          continue;
+        }
+        std::shared_ptr<handler_type> handler;
+        {
+          std::lock_guard lock(_handlers_mutex);
+          if (auto it = _handlers.find(events[i].data.fd); it != _handlers.end()) {
+            handler = it->second;
+          }
+        }
+        if (handler) {
+          (*handler)(events[i].events);
+        }
+      }
+    }
+  }
+
+ private:
+  const int _epoll_fd;
+  /// eventfd used to wake up the reactor thread for shutdown
+  const int _wake_fd;
+  std::atomic_bool _running = true;
+  std::thread _thread;
+  std::mutex _handlers_mutex;
+  std::unordered_map<int, std::shared_ptr<handler_type>> _handlers;
+};
+
+}  // namespace ipcpp::event
@@ -0,0 +1,298 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/event/epoll_reactor.h>
+#include <ipcpp/event/error.h>
+#include <ipcpp/event/notification.h>
+#include <ipcpp/event/notifier.h>
+
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ipcpp::event {
+
+/**
+ * @brief Notifier_I implementation based on Linux eventfds.
+ *
+ * Every subscribed observer gets its own eventfd which is created by the notifier and passed to the observer over a
+ * unix domain socket (SCM_RIGHTS). notify_observers(n) adds n to the counter of each eventfd. The observer side
+ * (EventFdObserver) reads the accumulated counter, i.e. notifications are coalesced: an observer that has not read in
+ * a while is woken up once and receives the number of notifications it missed.
+ *
+ * The subscription socket (/tmp/<id>.ipcpp.efd.sock) is only used for subscription handling and observer requests
+ * and is served by an EpollReactor, no notification data is sent over it.
+ *
+ * @implements Notifier_I
+ */
+class EventFdNotifier final : public Notifier_I<std::uint64_t> {
+ public:
+  typedef Notifier_I<std::uint64_t> notifier_base;
+
+ private:
+  struct ObserverConnection {
+    int event_fd = -1;
+    bool paused = false;
+  };
+
+  /// shared with the handlers running on the reactor thread, outlives the notifier if a handler is still running
+  struct State {
+    std::mutex mutex;
+    std::string socket_path;
+    int socket = -1;
+    std::size_t max_observers = 0;
+    bool accepting = false;
+    /// subscription connection fd -> observer
+    std::unordered_map<int, ObserverConnection> observers;
+    /// handlers only run while the reactor is alive (it joins its thread on destruction)
+    EpollReactor* reactor = nullptr;
+  };
+
+ public:
+  EventFdNotifier(EventFdNotifier&&) noexcept = default;
+  EventFdNotifier(const EventFdNotifier&) = delete;
+
+  ~EventFdNotifier() override {
+    if (_state) {
+      shutdown();
+    }
+  }
+
+  /**
+   * @brief Create an EventFdNotifier accepting subscriptions on /tmp/<id>.ipcpp.efd.sock.
+   *
+   * @param id notifier name
+   * @param max_num_observers maximum number of observers
+   * @param reactor event loop serving subscription requests, defaults to EpollReactor::shared()
+   */
+  static std::expected<EventFdNotifier, std::error_code> create(
+      std::string&& id, std::uint16_t max_num_observers = std::numeric_limits<uint16_t>::max(),
+      std::shared_ptr<EpollReactor> reactor = nullptr) {
+    if (!reactor) {
+      auto e_reactor = EpollReactor::shared();
+      if (!e_reactor) {
+        return std::unexpected(e_reactor.error());
+      }
+      reactor = std::move(e_reactor.value());
+    }
+    EventFdNotifier self(std::move(id), std::move(reactor));
+    self._state->max_observers = max_num_observers;
+    if (auto error = self._m_setup_socket(); error) {
+      return std::unexpected(error);
+    }
+    return self;
+  }
+
+  /**
+   * @brief Unregister all sockets from the reactor and close them. Observers see the subscription connection hang up.
+   */
+  void shutdown() {
+    std::lock_guard lock(_state->mutex);
+    if (_state->socket == -1) {
+      return;
+    }
+    if (_state->accepting) {
+      _reactor->remove(_state->socket);
+    }
+    for (auto it = _state->observers.begin(); it != _state->observers.end();) {
+      it = _m_close_observer(*_state, _reactor.get(), it);
+    }
+    close(_state->socket);
+    unlink(_state->socket_path.c_str());
+    _state->socket = -1;
+  }
+
+  /**
+   * @brief Add value to the eventfd counter of every subscribed, not paused observer. One write() per observer, the
+   *  call never blocks.
+   *
+   * @param value number of events, must be > 0 to wake observers up
+   */
+  void notify_observers(std::uint64_t value) override {
+    std::lock_guard lock(_state->mutex);
+    for (const auto& [fd, observer] : _state->observers) {
+      if (!observer.paused) {
+        // EAGAIN only happens if the counter would overflow, the observer is already woken up in that case
+        [[maybe_unused]] const ssize_t result = write(observer.event_fd, &value, sizeof(value));
+      }
+    }
+  }
+
+  /// notify observers about a single event
+  void notify_observers() { notify_observers(1); }
+
+  void accept_subscriptions() override {
+    std::lock_guard lock(_state->mutex);
+    if (_state->accepting || _state->socket == -1) {
+      return;
+    }
+    if (!_reactor->add(_state->socket, EPOLLIN, [weak_state = std::weak_ptr<State>(_state)](std::uint32_t) {
+          if (auto state = weak_state.lock(); state) {
+            _m_handle_subscriptions(state);
+          }
+        })) {
+      _state->accepting = true;
+    }
+  }
+
+  void reject_subscriptions() override {
+    std::lock_guard lock(_state->mutex);
+    if (!_state->accepting) {
+      return;
+    }
+    _reactor->remove(_state->socket);
+    _state->accepting = false;
+  }
+
+  [[nodiscard]] std::size_t num_observers() const override {
+    std::lock_guard lock(_state->mutex);
+    return _state->observers.size();
+  }
+
+ private:
+  EventFdNotifier(std::string&& id, std::shared_ptr<EpollReactor>&& reactor)
+      : _state(std::make_shared<State>()), _reactor(std::move(reactor)) {
+    _state->socket_path = "/tmp/" + std::move(id) + ".ipcpp.efd.sock";
+    _state->reactor = _reactor.get();
+    notifier_base::_id = _state->socket_path;
+  }
+
+  std::error_code _m_setup_socket() {
+    _state->socket = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (_state->socket == -1) {
+      return {static_cast<int>(socket_error_t::create_error), socket_error_category()};
+    }
+
+    sockaddr_un server_addr{};
+    server_addr.sun_family = AF_UNIX;
+    strncpy(server_addr.sun_path, _state->socket_path.c_str(), sizeof(server_addr.sun_path) - 1);
+    unlink(_state->socket_path.c_str());
+
+    if (bind(_state->socket, reinterpret_cast<sockaddr*>(&server_addr), sizeof(server_addr)) == -1) {
+      return {static_cast<int>(socket_error_t::bind_error), socket_error_category()};
+    }
+    if (listen(_state->socket, static_cast<int>(_state->max_observers)) == -1) {
+      return {static_cast<int>(socket_error_t::listen_error), socket_error_category()};
+    }
+    return {};
+  }
+
+  /// send the subscription response together with event_fd (SCM_RIGHTS)
+  static bool _m_send_event_fd(const int socket, const int event_fd) {
+    bool response = true;
+    iovec iov{.iov_base = &response, .iov_len = sizeof(response)};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))]{};
+
+    msghdr message{};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&message);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(cmsg), &event_fd, sizeof(int));
+
+    return sendmsg(socket, &message, MSG_NOSIGNAL) == sizeof(response);
+  }
+
+  static std::unordered_map<int, ObserverConnection>::iterator _m_close_observer(
+      State& state, EpollReactor* reactor, std::unordered_map<int, ObserverConnection>::iterator it) {
+    reactor->remove(it->first);
+    close(it->first);
+    close(it->second.event_fd);
+    return state.observers.erase(it);
+  }
+
+  /// reactor thread: accept all pending subscriptions of the listening socket
+  static void _m_handle_subscriptions(const std::shared_ptr<State>& state) {
+    EpollReactor* reactor = state->reactor;
+    std::lock_guard lock(state->mutex);
+    while (true) {
+      const int client_fd = accept4(state->socket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (client_fd == -1) {
+        return;
+      }
+      if (state->observers.size() >= state->max_observers) {
+        close(client_fd);
+        continue;
+      }
+      const int event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+      if (event_fd == -1 || !_m_send_event_fd(client_fd, event_fd)) {
+        if (event_fd != -1) {
+          close(event_fd);
+        }
+        close(client_fd);
+        continue;
+      }
+      state->observers.emplace(client_fd, ObserverConnection{.event_fd = event_fd});
+      reactor->add(client_fd, EPOLLIN, [weak_state = std::weak_ptr<State>(state), client_fd](std::uint32_t events) {
+        if (auto locked_state = weak_state.lock(); locked_state) {
+          _m_handle_observer(locked_state, client_fd, events);
+        }
+      });
+    }
+  }
+
+  /// reactor thread: process observer requests on the subscription connection
+  static void _m_handle_observer(const std::shared_ptr<State>& state, int fd, std::uint32_t events) {
+    EpollReactor* reactor = state->reactor;
+    std::lock_guard lock(state->mutex);
+    auto it = state->observers.find(fd);
+    if (it == state->observers.end()) {
+      return;
+    }
+    if (events & (EPOLLHUP | EPOLLERR)) {
+      _m_close_observer(*state, reactor, it);
+      return;
+    }
+    ObserverRequest request;
+    while (true) {
+      const ssize_t bytes = recv(fd, &request, sizeof(request), MSG_DONTWAIT);
+      if (bytes == 0) {
+        _m_close_observer(*state, reactor, it);
+        return;
+      }
+      if (bytes != sizeof(request)) {
+        return;
+      }
+      switch (request) {
+        case ObserverRequest::SUBSCRIBE:
+          break;
+        case ObserverRequest::CANCEL_SUBSCRIPTION:
+          _m_close_observer(*state, reactor, it);
+          return;
+        case ObserverRequest::PAUSE_SUBSCRIPTION:
+          it->second.paused = true;
+          break;
+        case ObserverRequest::RESUME_SUBSCRIPTION:
+          it->second.paused = false;
+          break;
+      }
+    }
+  }
+
+ private:
+  std::shared_ptr<State> _state;
+  std::shared_ptr<EpollReactor> _reactor;
+};
+
+}  // namespace ipcpp::event
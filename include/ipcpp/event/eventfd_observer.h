@@ -0,0 +1,215 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/event/error.h>
+#include <ipcpp/event/notification.h>
+#include <ipcpp/event/observer.h>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace ipcpp::event {
+
+/**
+ * @brief Observer_I implementation receiving notifications of an EventFdNotifier.
+ *
+ * On subscription the notifier passes an eventfd to the observer. A received notification is the number of events
+ * that were notified since the last receive (eventfd counters coalesce). native_handle() exposes the eventfd so that
+ * it can be multiplexed with other file descriptors in poll/epoll; once it is readable, receive() returns without
+ * blocking.
+ *
+ * @implements Observer_I
+ */
+class EventFdObserver final : public Observer_I<std::uint64_t> {
+ public:
+  typedef Observer_I<std::uint64_t> observer_base;
+
+ public:
+  EventFdObserver(EventFdObserver&& other) noexcept
+      : observer_base(std::move(other)),
+        _id(std::move(other._id)),
+        _socket(std::exchange(other._socket, -1)),
+        _event_fd(std::exchange(other._event_fd, -1)) {}
+
+  EventFdObserver(const EventFdObserver&) = delete;
+
+  ~EventFdObserver() override {
+    if (observer_base::is_subscribed()) {
+      EventFdObserver::cancel_subscription();
+    }
+    _m_close();
+  }
+
+  /**
+   * @brief Create an observer for the EventFdNotifier identified by id.
+   *
+   * @param id notifier name (the same id that was passed to EventFdNotifier::create())
+   */
+  static std::expected<EventFdObserver, std::error_code> create(std::string&& id) {
+    return EventFdObserver(std::move(id));
+  }
+
+  std::error_code subscribe() override {
+    if (observer_base::is_subscribed()) {
+      return {};
+    }
+
+    _socket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (_socket == -1) {
+      return {static_cast<int>(error_t::subscription_failed), error_category()};
+    }
+
+    sockaddr_un server_addr{};
+    server_addr.sun_family = AF_UNIX;
+    strncpy(server_addr.sun_path, _id.c_str(), sizeof(server_addr.sun_path) - 1);
+
+    if (connect(_socket, reinterpret_cast<sockaddr*>(&server_addr), sizeof(server_addr)) == -1) {
+      _m_close();
+      return {static_cast<int>(error_t::notifier_down), error_category()};
+    }
+
+    if (!_m_receive_event_fd()) {
+      _m_close();
+      return {static_cast<int>(error_t::subscription_failed), error_category()};
+    }
+
+    observer_base::_subscribed = true;
+    observer_base::_subscription_paused = false;
+    return {};
+  }
+
+  std::error_code cancel_subscription() override {
+    if (!observer_base::is_subscribed()) {
+      return {static_cast<int>(error_t::not_subscribed), error_category()};
+    }
+
+    constexpr auto request = ObserverRequest::CANCEL_SUBSCRIPTION;
+    const bool sent = send(_socket, &request, sizeof(request), MSG_NOSIGNAL) != -1;
+    _m_close();
+    observer_base::_subscribed = false;
+    observer_base::_subscription_paused = false;
+    if (!sent) {
+      return {static_cast<int>(error_t::notifier_down), error_category()};
+    }
+    return {};
+  }
+
+  std::expected<void, std::error_code> pause_subscription() override {
+    return _m_request(ObserverRequest::PAUSE_SUBSCRIPTION, true);
+  }
+
+  std::expected<void, std::error_code> resume_subscription() override {
+    return _m_request(ObserverRequest::RESUME_SUBSCRIPTION, false);
+  }
+
+  /**
+   * @brief eventfd of the active subscription (-1 if not subscribed). It becomes readable (POLLIN/EPOLLIN) when
+   *  notifications are pending. Do not read from it directly, use receive() instead.
+   */
+  [[nodiscard]] int native_handle() const noexcept { return _event_fd; }
+
+ private:
+  explicit EventFdObserver(std::string&& id) : _id("/tmp/" + std::move(id) + ".ipcpp.efd.sock") {}
+
+  void _m_close() {
+    if (_event_fd != -1) {
+      close(_event_fd);
+      _event_fd = -1;
+    }
+    if (_socket != -1) {
+      ::shutdown(_socket, SHUT_RDWR);
+      close(_socket);
+      _socket = -1;
+    }
+  }
+
+  /// receive the subscription response and the eventfd (SCM_RIGHTS) sent by EventFdNotifier
+  bool _m_receive_event_fd() {
+    bool response = false;
+    iovec iov{.iov_base = &response, .iov_len = sizeof(response)};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))]{};
+
+    msghdr message{};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    if (recvmsg(_socket, &message, MSG_CMSG_CLOEXEC) != sizeof(response) || !response) {
+      return false;
+    }
+    const cmsghdr* cmsg = CMSG_FIRSTHDR(&message);
+    if (cmsg == nullptr || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+      return false;
+    }
+    std::memcpy(&_event_fd, CMSG_DATA(cmsg), sizeof(int));
+    return true;
+  }
+
+  std::expected<void, std::error_code> _m_request(const ObserverRequest request, const bool paused) {
+    if (!observer_base::is_subscribed()) {
+      return std::unexpected(std::error_code(static_cast<int>(error_t::not_subscribed), error_category()));
+    }
+    if (observer_base::is_subscription_paused() == paused) {
+      return {};
+    }
+    if (send(_socket, &request, sizeof(request), MSG_NOSIGNAL) == -1) {
+      return std::unexpected(std::error_code(static_cast<int>(error_t::notifier_down), error_category()));
+    }
+    observer_base::_subscription_paused = paused;
+    return {};
+  }
+
+  std::expected<std::any, std::error_code> _m_receive_helper(
+      const std::function<std::any(notification_type)>& callback, const std::chrono::milliseconds timeout) override {
+    std::uint64_t value = 0;
+    // the eventfd is non-blocking: read first, only poll if no event is pending
+    while (read(_event_fd, &value, sizeof(value)) != sizeof(value)) {
+      if (errno != EAGAIN && errno != EINTR) {
+        return std::unexpected(std::error_code(static_cast<int>(error_t::unknown_error), error_category()));
+      }
+      // the subscription socket is polled as well to detect a notifier that went down
+      pollfd fds[2] = {{.fd = _event_fd, .events = POLLIN, .revents = 0},
+                       {.fd = _socket, .events = POLLIN, .revents = 0}};
+      const int result = poll(fds, 2, timeout.count() > 0 ? static_cast<int>(timeout.count()) : -1);
+      if (result == 0) {
+        return std::unexpected(std::error_code(static_cast<int>(error_t::timeout), error_category()));
+      }
+      if (result == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return std::unexpected(std::error_code(static_cast<int>(error_t::unknown_error), error_category()));
+      }
+      if (!(fds[0].revents & POLLIN) && (fds[1].revents & (POLLIN | POLLHUP | POLLERR))) {
+        return std::unexpected(std::error_code(static_cast<int>(error_t::notifier_down), error_category()));
+      }
+    }
+    return callback(value);
+  }
+
+ private:
+  /// notifier subscription socket path
+  std::string _id;
+  /// subscription connection, used for observer requests
+  int _socket = -1;
+  /// eventfd received from the notifier
+  int _event_fd = -1;
+};
+
+}  // namespace ipcpp::event
@@ -93,7 +93,7 @@ class Observer_I {
 
     auto result = _m_receive_helper(func, timeout);
 
-    if (!result) return std::unexpected(std::error_code());
+    if (!result) return std::unexpected(result.error());
     if constexpr (std::is_void_v<ReturnType>) {
       return {};
     } else {
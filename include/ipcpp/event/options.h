@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 
 namespace ipcpp::event {
@@ -18,6 +19,14 @@ struct Options {
   std::size_t queue_size;
 };
 
+/// Batching of notifications sent by socket based notifiers (see DomainSocketNotifier)
+struct BatchOptions {
+  /// number of notifications accumulated before they are sent to the observers (1 disables batching)
+  std::size_t max_batch_size = 1;
+  /// maximum time a notification is held back before an incomplete batch is sent anyway
+  std::chrono::microseconds max_batch_delay = std::chrono::milliseconds(1);
+};
+
 }
 
 namespace observer {
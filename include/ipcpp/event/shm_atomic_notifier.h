@@ -11,7 +11,9 @@
 #include <ipcpp/event/shm_notification_memory_layout.h>
 #include <ipcpp/utils/reference_counted.h>
 #include <ipcpp/shm/mapped_memory.h>
+#include <ipcpp/utils/mutex.h>
 
+#include <chrono>
 #include <expected>
 #include <utility>
 
@@ -30,7 +32,7 @@ class ShmAtomicNotifier final {
   ShmAtomicNotifier(const ShmAtomicNotifier& other) = delete;
 
   static std::expected<ShmAtomicNotifier, std::error_code> create(const std::string& topic_id) {
-    auto e_topic = get_shm_entry(topic_id, sizeof(event_id_type));
+    auto e_topic = get_shm_entry(topic_id, sizeof(shm_atomic_event));
     if (!e_topic) {
       return std::unexpected(e_topic.error());
     }
@@ -39,17 +41,30 @@ class ShmAtomicNotifier final {
   }
 
   void notify_observers(const uint64_t add_val = 1) {
-    _n_value->fetch_add(add_val, std::memory_order_relaxed);
+    // seq_cst pairs with waiting observers: either they see the new value or we see them waiting
+    _event->value.fetch_add(add_val, std::memory_order_seq_cst);
+    if (_event->num_waiting_observers.load(std::memory_order_seq_cst) > 0) [[unlikely]] {
+      _event->futex.fetch_add(1, std::memory_order_release);
+      futex_wake(_event->futex);
+    }
+  }
+
+  /**
+   * @brief Number of observers currently attached to the topic, read from shared memory without any syscall.
+   * @param max_heartbeat_age if not 0, observers that did not receive (or call heartbeat()) for longer are ignored
+   */
+  [[nodiscard]] std::size_t num_observers(const std::chrono::nanoseconds max_heartbeat_age = 0ns) const {
+    return _event->subscriptions.num_subscribers(max_heartbeat_age);
   }
 
  private:
   explicit ShmAtomicNotifier(std::shared_ptr<ShmRegistryEntry>&& topic) : _topic(std::move(topic)) {
-    _n_value = reinterpret_cast<event_id_type*>(_topic->shm().addr());
+    _event = reinterpret_cast<shm_atomic_event*>(_topic->shm().addr());
   }
 
  private:
   std::shared_ptr<ShmRegistryEntry> _topic;
-  event_id_type* _n_value = nullptr;
+  shm_atomic_event* _event = nullptr;
 };
 
 }  // namespace ipcpp::event
\ No newline at end of file
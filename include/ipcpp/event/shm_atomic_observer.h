@@ -10,9 +10,12 @@
 #include <ipcpp/event/notification.h>
 #include <ipcpp/event/observer.h>
 #include <ipcpp/event/shm_notification_memory_layout.h>
+#include <ipcpp/event/wait_policy.h>
+#include <ipcpp/utils/mutex.h>
 #include <ipcpp/utils/reference_counted.h>
 
 #include <cstring>
+#include <limits>
 #include <utility>
 
 #include "shm_atomic_notifier.h"
@@ -21,41 +24,99 @@ using namespace std::chrono_literals;
 
 namespace ipcpp::event {
 
-class ShmAtomicObserver {
+/**
+ * @brief Observes the event counter of a ShmAtomicNotifier.
+ *
+ * @tparam WaitPolicyT how receive() waits for the next event (see wait_policy::BusySpin, wait_policy::SpinYield,
+ *  wait_policy::SpinThenPark). The notifier only issues a FUTEX_WAKE if an observer is parked.
+ */
+template <typename WaitPolicyT>
+  requires concepts::wait_policy<WaitPolicyT>
+class BasicShmAtomicObserver {
  public:
   typedef std::atomic_uint64_t event_id_type;
+  typedef WaitPolicyT wait_policy_type;
 
  public:
-  static std::expected<ShmAtomicObserver, std::error_code> create(const std::string& topic_id) {
-    auto e_topic = get_shm_entry(topic_id);
-    while (!e_topic) {
-      std::this_thread::sleep_for(100ms);
-      e_topic = get_shm_entry(topic_id);
+  BasicShmAtomicObserver(BasicShmAtomicObserver&& other) noexcept
+      : _topic(std::move(other._topic)),
+        _event(std::exchange(other._event, nullptr)),
+        _last_value(other._last_value),
+        _subscription_idx(std::exchange(other._subscription_idx, invalid_subscription)) {}
+
+  BasicShmAtomicObserver(const BasicShmAtomicObserver&) = delete;
+
+  ~BasicShmAtomicObserver() {
+    if (_event != nullptr && _subscription_idx != invalid_subscription) {
+      _event->subscriptions.unsubscribe(_subscription_idx);
     }
-    return ShmAtomicObserver(std::move(*e_topic));
   }
 
+  /**
+   * @brief Attach to the topic and register in its shared memory subscription table.
+   *
+   * The shared memory is created if the notifier does not exist yet (the zero initialized layout is valid), so this
+   * never waits for the notifier.
+   */
+  static std::expected<BasicShmAtomicObserver, std::error_code> create(const std::string& topic_id) {
+    auto e_topic = get_shm_entry(topic_id, sizeof(shm_atomic_event));
+    if (!e_topic) {
+      return std::unexpected(e_topic.error());
+    }
+    BasicShmAtomicObserver self(std::move(*e_topic));
+    auto e_idx = self._event->subscriptions.subscribe();
+    if (!e_idx) {
+      return std::unexpected(e_idx.error());
+    }
+    self._subscription_idx = *e_idx;
+    return self;
+  }
+
+  /**
+   * @brief Wait for the next event according to WaitPolicyT.
+   * @return current value of the event counter
+   */
   uint64_t receive() {
-    uint64_t value = _n_value->load(std::memory_order_acquire);
-    while (value == _last_value) {
-      std::this_thread::yield();
-      value = _n_value->load(std::memory_order_acquire);
+    uint64_t value = _event->value.load(std::memory_order_acquire);
+    if (value == _last_value) {
+      WaitPolicyT::wait_until(wait_handle(), [this, &value]() {
+        value = _event->value.load(std::memory_order_acquire);
+        return value != _last_value;
+      });
     }
     _last_value = value;
+    heartbeat();
     return value;
   }
 
+  /// signal liveness to the notifier without receiving (see ShmAtomicNotifier::num_observers)
+  void heartbeat() { _event->subscriptions.heartbeat(_subscription_idx); }
+
+  /// true if receive() would return without waiting
+  [[nodiscard]] bool has_new_data() const {
+    return _event->value.load(std::memory_order_seq_cst) != _last_value;
+  }
+
+  /// futex word the notifier bumps on notify_observers (used by event::WaitSet)
+  [[nodiscard]] FutexWaitHandle wait_handle() const { return {&_event->futex, &_event->num_waiting_observers}; }
+
  private:
-  explicit ShmAtomicObserver(std::shared_ptr<ShmRegistryEntry>&& topic)
+  explicit BasicShmAtomicObserver(std::shared_ptr<ShmRegistryEntry>&& topic)
       : _topic(std::move(topic)) {
-    _last_value = reinterpret_cast<event_id_type*>(_topic->shm().addr())->load(std::memory_order_acquire);
-    _n_value = reinterpret_cast<event_id_type*>(_topic->shm().addr());
+    _event = reinterpret_cast<shm_atomic_event*>(_topic->shm().addr());
+    _last_value = _event->value.load(std::memory_order_acquire);
   }
 
  private:
   std::shared_ptr<ShmRegistryEntry> _topic;
-  event_id_type* _n_value = nullptr;
+  shm_atomic_event* _event = nullptr;
   uint64_t _last_value;
+  std::size_t _subscription_idx = invalid_subscription;
+
+  static constexpr std::size_t invalid_subscription = std::numeric_limits<std::size_t>::max();
 };
 
+/// yields while waiting, the behaviour of ShmAtomicObserver before wait policies were introduced
+typedef BasicShmAtomicObserver<wait_policy::SpinYield<>> ShmAtomicObserver;
+
 }  // namespace ipcpp::event
\ No newline at end of file
@@ -0,0 +1,83 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/event/shm_notification_memory_layout.h>
+#include <ipcpp/topic.h>
+#include <ipcpp/utils/mutex.h>
+
+#include <atomic>
+#include <expected>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace ipcpp::event {
+
+/**
+ * @brief Broadcasts notifications through shared memory: notifications are queued in a broadcast ring and observers
+ *  (ShmCondVarObserver) blocked on the process-shared condition variable of the topic are woken up. No sockets or
+ *  helper threads are involved, a notification costs a futex wake only if an observer is blocked.
+ *
+ * @tparam NotificationT trivially copyable notification type
+ */
+template <typename NotificationT>
+  requires std::is_trivially_copyable_v<NotificationT>
+class ShmCondVarNotifier {
+ public:
+  typedef NotificationT notification_type;
+  typedef shm_notification_memory_layout<NotificationT, shm_condition_variable_notification_header> layout_type;
+
+ public:
+  ShmCondVarNotifier(ShmCondVarNotifier&& other) noexcept = default;
+  ShmCondVarNotifier(const ShmCondVarNotifier&) = delete;
+
+  /**
+   * @brief Create the notifier of topic_id.
+   *
+   * @param topic_id topic name
+   * @param queue_size number of notifications observers can lag behind before they lose notifications
+   */
+  static std::expected<ShmCondVarNotifier, std::error_code> create(const std::string& topic_id,
+                                                                   const std::size_t queue_size = 64) {
+    auto e_topic = get_shm_entry(topic_id, layout_type::required_bytes_for(queue_size));
+    if (!e_topic) {
+      return std::unexpected(e_topic.error());
+    }
+    return ShmCondVarNotifier(std::move(e_topic.value()));
+  }
+
+  /**
+   * @brief Queue notification and wake up all blocked observers.
+   */
+  void notify_observers(const notification_type& notification) {
+    auto* header = _layout.header;
+    {
+      std::unique_lock lock(header->mutex);
+      ++header->message_counter;
+      header->latest_buffer_index = _layout.message_buffer.emplace(header->message_counter, notification);
+    }
+    header->cv.notify_all();
+  }
+
+  [[nodiscard]] std::size_t num_observers() const {
+    return std::atomic_ref<std::size_t>(_layout.header->num_subscribers).load(std::memory_order_acquire);
+  }
+
+ private:
+  explicit ShmCondVarNotifier(std::shared_ptr<ShmRegistryEntry>&& topic)
+      : _topic(std::move(topic)), _layout(_topic->shm().addr(), _topic->shm().size()) {
+    _layout.header->initialized.store(1, std::memory_order_release);
+  }
+
+ private:
+  std::shared_ptr<ShmRegistryEntry> _topic;
+  layout_type _layout;
+};
+
+}  // namespace ipcpp::event
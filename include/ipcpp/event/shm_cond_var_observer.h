@@ -0,0 +1,131 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/event/shm_cond_var_notifier.h>
+#include <ipcpp/event/shm_notification_memory_layout.h>
+#include <ipcpp/topic.h>
+#include <ipcpp/utils/mutex.h>
+
+#include <atomic>
+#include <chrono>
+#include <expected>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace ipcpp::event {
+
+/**
+ * @brief Receives the notifications of a ShmCondVarNotifier in order. receive() blocks on the process-shared condition
+ *  variable of the topic if no notification is queued.
+ *
+ * @tparam NotificationT must match the NotificationT of the notifier
+ */
+template <typename NotificationT>
+  requires std::is_trivially_copyable_v<NotificationT>
+class ShmCondVarObserver {
+ public:
+  typedef NotificationT notification_type;
+  typedef typename ShmCondVarNotifier<NotificationT>::layout_type layout_type;
+
+ public:
+  ShmCondVarObserver(ShmCondVarObserver&& other) noexcept
+      : _topic(std::move(other._topic)), _layout(std::move(other._layout)), _cursor(other._cursor) {}
+  ShmCondVarObserver(const ShmCondVarObserver&) = delete;
+
+  ~ShmCondVarObserver() {
+    if (_topic) {
+      std::atomic_ref<std::size_t>(_layout.header->num_subscribers).fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  /**
+   * @brief Create an observer of topic_id. Waits until the notifier of topic_id was created.
+   *
+   * @param timeout maximum time to wait for the notifier
+   * @return the observer or std::errc::timed_out if no notifier of topic_id was created within timeout
+   */
+  static std::expected<ShmCondVarObserver, std::error_code> create(
+      const std::string& topic_id, const std::chrono::milliseconds timeout = std::chrono::milliseconds(1000)) {
+    using namespace std::chrono_literals;
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    auto e_topic = get_shm_entry(topic_id);
+    while (!e_topic) {
+      if (std::chrono::steady_clock::now() >= deadline) {
+        return std::unexpected(std::make_error_code(std::errc::timed_out));
+      }
+      std::this_thread::sleep_for(1ms);
+      e_topic = get_shm_entry(topic_id);
+    }
+    auto* header = reinterpret_cast<shm_condition_variable_notification_header*>(e_topic.value()->shm().addr());
+    // the shm is created before the notifier initializes its header
+    while (header->initialized.load(std::memory_order_acquire) == 0) {
+      if (std::chrono::steady_clock::now() >= deadline) {
+        return std::unexpected(std::make_error_code(std::errc::timed_out));
+      }
+      std::this_thread::sleep_for(1ms);
+    }
+    return ShmCondVarObserver(std::move(e_topic.value()));
+  }
+
+  /**
+   * @brief Return the next notification, blocking until one is available or timeout expired.
+   *
+   * @param timeout maximum time to wait, std::nullopt waits forever
+   * @return the notification, or
+   *  - std::errc::timed_out if no notification arrived within timeout
+   *  - std::errc::value_too_large if notifications were overwritten before they were received, the next receive()
+   *    continues with the oldest notification that is still available
+   */
+  std::expected<notification_type, std::error_code> receive(
+      const std::optional<std::chrono::nanoseconds> timeout = std::nullopt) {
+    while (true) {
+      if (auto e_notification = try_receive();
+          e_notification.has_value() || e_notification.error() != std::errc::no_message_available) {
+        return e_notification;
+      }
+      auto* header = _layout.header;
+      std::unique_lock lock(header->mutex);
+      const auto has_notification = [this]() { return _layout.message_buffer.next_index() != _cursor; };
+      if (!timeout.has_value()) {
+        header->cv.wait(lock, has_notification);
+      } else if (!header->cv.wait_for(lock, timeout.value(), has_notification)) {
+        return std::unexpected(std::make_error_code(std::errc::timed_out));
+      }
+    }
+  }
+
+  /**
+   * @brief Non-blocking receive().
+   * @return the notification or std::errc::no_message_available (see receive() for other errors)
+   */
+  std::expected<notification_type, std::error_code> try_receive() {
+    auto e_message = _layout.message_buffer.try_read(_cursor);
+    if (!e_message) {
+      return std::unexpected(e_message.error());
+    }
+    return e_message->message;
+  }
+
+ private:
+  explicit ShmCondVarObserver(std::shared_ptr<ShmRegistryEntry>&& topic)
+      : _topic(std::move(topic)), _layout(_topic->shm().addr()), _cursor(_layout.message_buffer.next_index()) {
+    std::atomic_ref<std::size_t>(_layout.header->num_subscribers).fetch_add(1, std::memory_order_release);
+  }
+
+ private:
+  std::shared_ptr<ShmRegistryEntry> _topic;
+  layout_type _layout;
+  /// index of the next notification in the broadcast ring
+  std::uint64_t _cursor = 0;
+};
+
+}  // namespace ipcpp::event
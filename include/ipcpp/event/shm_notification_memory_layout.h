@@ -7,13 +7,13 @@
 
 #pragma once
 
-#include <ipcpp/shm/ring_buffer.h>
+#include <ipcpp/event/shm_subscription_table.h>
+#include <ipcpp/shm/broadcast_ring_buffer.h>
+#include <ipcpp/utils/mutex.h>
 #include <ipcpp/utils/utils.h>
 
 #include <atomic>
-#include <condition_variable>
 #include <cstdint>
-#include <mutex>
 
 namespace ipcpp::event {
 
@@ -22,18 +22,34 @@ struct shm_atomic_notification_header {
   alignas(std::hardware_destructive_interference_size) std::atomic_size_t num_subscribers = 0;
 };
 
+/// shared memory of ShmAtomicNotifier/ShmAtomicObserver, valid if zero initialized
+struct shm_atomic_event {
+  /// event counter, increased by ShmAtomicNotifier::notify_observers
+  std::atomic_uint64_t value = 0;
+  /// observers that block (e.g. in an event::WaitSet) park on futex, the notifier only bumps and wakes it if
+  /// num_waiting_observers is not 0
+  std::atomic<std::uint32_t> futex = 0;
+  std::atomic<std::uint32_t> num_waiting_observers = 0;
+  /// observers register here on creation, the notifier reads it directly (see ShmSubscriptionTable)
+  ShmSubscriptionTable<64> subscriptions;
+};
+
+/// header of ShmCondVarNotifier/ShmCondVarObserver: mutex and cv are process-shared (futex based)
 struct shm_condition_variable_notification_header {
+  /// set to 1 (release) by the notifier once the memory layout is initialized
+  std::atomic_uint32_t initialized = 0;
   std::int64_t message_counter = -1;
   std::size_t latest_buffer_index = 0;
   std::size_t num_subscribers = 0;
-  std::mutex mutex;
-  std::condition_variable cv;
+  futex mutex;
+  condition_variable cv;
 };
 
 template <typename T_Message, typename T_Header>
 struct shm_notification_memory_layout {
   static std::size_t required_bytes_for(std::size_t queue_size) {
-    return utils::align_up(sizeof(T_Header)) + shm::ring_buffer<message_type>::required_bytes_for(queue_size);
+    return utils::align_up(sizeof(T_Header), std::hardware_destructive_interference_size) +
+           shm::broadcast_ring_buffer<message_type>::required_bytes_for(queue_size);
   }
 
   /// a message is a tuple consisting of the message and the message_number
@@ -50,17 +66,20 @@ struct shm_notification_memory_layout {
   template <typename... T_HeaderArgs>
   shm_notification_memory_layout(std::uintptr_t addr, const std::size_t size, T_HeaderArgs&&... args)
       : header(std::construct_at(reinterpret_cast<header_type*>(addr), std::forward<T_HeaderArgs>(args)...)),
-        message_buffer(addr + utils::align_up(sizeof(header_type)), size - utils::align_up(sizeof(header_type))) {}
+        message_buffer(addr + utils::align_up(sizeof(header_type), std::hardware_destructive_interference_size),
+                       size - utils::align_up(sizeof(header_type), std::hardware_destructive_interference_size)) {}
 
   explicit shm_notification_memory_layout(std::uintptr_t addr)
-      : header(reinterpret_cast<header_type*>(addr)), message_buffer(addr + utils::align_up(sizeof(header_type))) {}
+      : header(reinterpret_cast<header_type*>(addr)),
+        message_buffer(addr + utils::align_up(sizeof(header_type), std::hardware_destructive_interference_size)) {}
 
   shm_notification_memory_layout(shm_notification_memory_layout&& other) noexcept : message_buffer(std::move(other.message_buffer)) {
     std::swap(header, other.header);
   }
 
   header_type* header = nullptr;
-  shm::ring_buffer<message_type> message_buffer;
+  /// observers read at their own pace and detect overruns (see shm::broadcast_ring_buffer::try_read)
+  shm::broadcast_ring_buffer<message_type> message_buffer;
 };
 
 }  // namespace ipcpp::event
\ No newline at end of file
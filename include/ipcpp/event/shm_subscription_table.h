@@ -0,0 +1,96 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/utils/system.h>
+#include <ipcpp/utils/utils.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <new>
+#include <system_error>
+
+namespace ipcpp::event {
+
+using namespace std::chrono_literals;
+
+/// subscription of a single observer process, pid == 0 marks a free slot
+struct ShmSubscriptionSlot {
+  alignas(std::hardware_destructive_interference_size) std::atomic_uint64_t pid = 0;
+  /// utils::timestamp() of the latest sign of life of the observer
+  std::atomic_int64_t heartbeat = 0;
+};
+
+/**
+ * @brief Subscription table placed in shared memory (valid if zero initialized).
+ *
+ * Observers claim a slot with a single CAS on its pid and release it on unsubscription, notifiers read the table
+ * directly: subscribing needs neither a syscall nor a notifier side thread. Slots of crashed observers (process is not
+ * alive anymore) are reclaimed by the next subscription. Observers may refresh their heartbeat so that notifiers can
+ * additionally ignore observers that stopped receiving (see num_subscribers()).
+ *
+ * @tparam N maximum number of concurrent subscriptions
+ */
+template <std::size_t N>
+struct ShmSubscriptionTable {
+  static constexpr std::size_t max_subscriptions = N;
+
+  /**
+   * @brief Claim a free slot for the calling process.
+   * @return slot index or std::errc::too_many_files_open if all slots are taken by alive observers
+   */
+  std::expected<std::size_t, std::error_code> subscribe() {
+    const std::uint64_t own_pid = utils::system::get_pid();
+    // first pass: free slots only (no syscalls), second pass: reclaim slots of observers that are not alive anymore
+    for (const bool reclaim : {false, true}) {
+      for (std::size_t idx = 0; idx < N; ++idx) {
+        ShmSubscriptionSlot& slot = slots[idx];
+        std::uint64_t pid = slot.pid.load(std::memory_order_acquire);
+        if (pid != 0 && (!reclaim || utils::system::is_process_alive(pid))) {
+          continue;
+        }
+        if (slot.pid.compare_exchange_strong(pid, own_pid, std::memory_order_acq_rel)) {
+          slot.heartbeat.store(utils::timestamp(), std::memory_order_release);
+          return idx;
+        }
+      }
+    }
+    return std::unexpected(std::make_error_code(std::errc::too_many_files_open));
+  }
+
+  void unsubscribe(const std::size_t idx) { slots[idx].pid.store(0, std::memory_order_release); }
+
+  void heartbeat(const std::size_t idx) { slots[idx].heartbeat.store(utils::timestamp(), std::memory_order_release); }
+
+  /**
+   * @brief Number of subscribed observers.
+   * @param max_heartbeat_age if not 0, observers whose heartbeat is older are not counted
+   */
+  [[nodiscard]] std::size_t num_subscribers(const std::chrono::nanoseconds max_heartbeat_age = 0ns) const {
+    const std::int64_t now = max_heartbeat_age.count() > 0 ? utils::timestamp() : 0;
+    std::size_t count = 0;
+    for (const ShmSubscriptionSlot& slot : slots) {
+      if (slot.pid.load(std::memory_order_acquire) == 0) {
+        continue;
+      }
+      if (max_heartbeat_age.count() > 0 &&
+          now - slot.heartbeat.load(std::memory_order_acquire) > max_heartbeat_age.count()) {
+        continue;
+      }
+      ++count;
+    }
+    return count;
+  }
+
+  ShmSubscriptionSlot slots[N];
+};
+
+}  // namespace ipcpp::event
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/utils/mutex.h>
+#include <ipcpp/utils/utils.h>
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace ipcpp::event {
+
+/**
+ * @brief Wait policies decide how an observer waits for the next event (latency vs. CPU usage). A policy provides
+ *  a static wait_until(handle, ready) that returns once ready() is true. handle is the futex word and waiter count of
+ *  the event source, policies that block must register in handle.num_waiters so that the notifier wakes them up.
+ */
+namespace wait_policy {
+
+/// lowest latency, occupies a core: spin with a cpu pause instruction until an event arrives
+struct BusySpin {
+  template <typename F>
+  static void wait_until(FutexWaitHandle, F&& ready) {
+    while (!ready()) {
+      utils::cpu_relax();
+    }
+  }
+};
+
+/// spin for SpinIterations, afterward yield the CPU between checks
+template <std::uint32_t SpinIterations = 128>
+struct SpinYield {
+  template <typename F>
+  static void wait_until(FutexWaitHandle, F&& ready) {
+    for (std::uint32_t iteration = 0; !ready(); ++iteration) {
+      if (iteration < SpinIterations) {
+        utils::cpu_relax();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+};
+
+/// spin for SpinIterations, then park on the futex of the event source until the notifier wakes us up
+template <std::uint32_t SpinIterations = 1024>
+struct SpinThenPark {
+  template <typename F>
+  static void wait_until(FutexWaitHandle handle, F&& ready) {
+    for (std::uint32_t iteration = 0; !ready(); ++iteration) {
+      if (iteration < SpinIterations) {
+        utils::cpu_relax();
+        continue;
+      }
+      park(handle, ready);
+    }
+  }
+
+  /**
+   * @brief Block on the futex of handle unless ready() is true already. The waiter is registered in
+   *  handle.num_waiters before ready() is checked: a notifier that did not see us waiting has already made ready() true
+   *  (seq_cst on both sides).
+   *
+   * @param timeout upper bound of the wait, std::nullopt blocks until a notifier wakes us up
+   * @return false if timeout expired without a wake up
+   */
+  template <typename F>
+  static bool park(FutexWaitHandle handle, F&& ready,
+                   const std::optional<std::chrono::nanoseconds> timeout = std::nullopt) {
+    bool woken = true;
+    handle.num_waiters->fetch_add(1, std::memory_order_seq_cst);
+    const std::uint32_t futex_value = handle.futex->load(std::memory_order_seq_cst);
+    if (!ready()) {
+      if (timeout.has_value()) {
+        woken = futex_wait(*handle.futex, futex_value, timeout.value());
+      } else {
+        futex_wait(*handle.futex, futex_value);
+      }
+    }
+    handle.num_waiters->fetch_sub(1, std::memory_order_release);
+    return woken;
+  }
+};
+
+/**
+ * @brief Back-off step after the iteration-th unsuccessful check of a wait loop whose budget is configured at run time
+ *  (e.g. ps::WaitStrategy): spin, yield, then park on handle for at most park_timeout (SpinThenPark::park). Keeps on
+ *  yielding instead of parking if strategy.park is false.
+ *
+ * @return false if parking timed out: the caller can check the liveness of the event source before it waits again
+ */
+template <typename T_Strategy, typename F>
+bool backoff(const T_Strategy& strategy, const std::uint64_t iteration, FutexWaitHandle handle, F&& ready,
+             const std::chrono::nanoseconds park_timeout) {
+  if (iteration < strategy.spin_iterations) {
+    utils::cpu_relax();
+  } else if (!strategy.park || iteration < strategy.spin_iterations + strategy.yield_iterations) {
+    std::this_thread::yield();
+  } else {
+    return SpinThenPark<>::park(handle, std::forward<F>(ready), park_timeout);
+  }
+  return true;
+}
+
+}  // namespace wait_policy
+
+namespace concepts {
+
+template <typename T>
+concept wait_policy = requires(FutexWaitHandle handle) {
+  { T::wait_until(handle, [] { return true; }) } -> std::same_as<void>;
+};
+
+}  // namespace concepts
+
+}  // namespace ipcpp::event
@@ -0,0 +1,158 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/utils/mutex.h>
+#include <ipcpp/utils/utils.h>
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <vector>
+
+namespace ipcpp::event {
+
+namespace concepts {
+
+/// sources that can be registered at a WaitSet (RealTimeSubscriber, Subscriber (Mode::Sequence), ShmAtomicObserver)
+template <typename T>
+concept waitable = requires(T& source) {
+  { source.wait_handle() } -> std::same_as<FutexWaitHandle>;
+  { source.has_new_data() } -> std::convertible_to<bool>;
+};
+
+}  // namespace concepts
+
+/**
+ * @brief Blocks until any of the registered sources has new data.
+ *
+ * Each source exposes the futex word its publishers/notifiers bump on publish (FutexWaitHandle). WaitSet::wait()
+ * registers itself as waiter at every source and parks on all futex words at once (futex_waitv), so a process
+ * subscribed to many topics needs a single syscall to wait for all of them. Readiness is checked with one atomic load
+ * per source, no syscalls are issued for topics without new data.
+ *
+ * @attention Sources are registered by reference: they must neither be moved nor destroyed while registered.
+ */
+class WaitSet {
+ public:
+  WaitSet() = default;
+
+  /**
+   * @brief Register source.
+   * @return index of source, used to identify it in the result of wait()
+   */
+  template <typename T>
+    requires concepts::waitable<T>
+  std::expected<std::size_t, std::error_code> add(T& source) {
+    if (_sources.size() >= futex_wait_any_max) {
+      return std::unexpected(std::make_error_code(std::errc::argument_list_too_long));
+    }
+    _sources.push_back({source.wait_handle(), [&source]() -> bool { return source.has_new_data(); }});
+    _futex_words.push_back(_sources.back().handle.futex);
+    _futex_values.push_back(0);
+    return _sources.size() - 1;
+  }
+
+  /// remove all sources
+  void clear() {
+    _sources.clear();
+    _futex_words.clear();
+    _futex_values.clear();
+    _ready.clear();
+  }
+
+  [[nodiscard]] std::size_t size() const { return _sources.size(); }
+
+  /**
+   * @brief Block until at least one source has new data or timeout expired.
+   *
+   * @param timeout maximum time to wait, std::nullopt waits forever
+   * @return indices (see add()) of all sources with new data, the span is valid until the next call of wait(). An
+   *  error (std::errc::timed_out) is returned if no source got new data within timeout,
+   *  std::errc::invalid_argument if no source is registered.
+   */
+  std::expected<std::span<const std::size_t>, std::error_code> wait(
+      std::optional<std::chrono::nanoseconds> timeout = std::nullopt) {
+    if (_sources.empty()) [[unlikely]] /*futex_waitv rejects an empty list: parking would spin*/ {
+      return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+    }
+    const auto deadline = timeout.has_value()
+                              ? std::optional(std::chrono::steady_clock::now() + timeout.value())
+                              : std::nullopt;
+    for (std::uint32_t iteration = 0;; ++iteration) {
+      if (_m_collect_ready()) {
+        return std::span<const std::size_t>(_ready);
+      }
+      if (iteration < spin_iterations) {
+        utils::cpu_relax();
+        continue;
+      }
+      if (deadline.has_value() && std::chrono::steady_clock::now() >= deadline.value()) {
+        return std::unexpected(std::make_error_code(std::errc::timed_out));
+      }
+      _m_park(deadline);
+    }
+  }
+
+ private:
+  struct Source {
+    FutexWaitHandle handle;
+    std::function<bool()> has_new_data;
+  };
+
+  /// number of readiness checks before parking
+  static constexpr std::uint32_t spin_iterations = 64;
+
+  bool _m_collect_ready() {
+    _ready.clear();
+    for (std::size_t idx = 0; idx < _sources.size(); ++idx) {
+      if (_sources[idx].has_new_data()) {
+        _ready.push_back(idx);
+      }
+    }
+    return !_ready.empty();
+  }
+
+  /**
+   * @brief Register as waiter at all sources and park on their futex words. Same handshake as a single subscriber
+   *  parking on its topic: either the waker sees our waiter count (seq_cst) or we see its new data.
+   */
+  void _m_park(const std::optional<std::chrono::steady_clock::time_point> deadline) {
+    for (std::size_t idx = 0; idx < _sources.size(); ++idx) {
+      _sources[idx].handle.num_waiters->fetch_add(1, std::memory_order_seq_cst);
+      _futex_values[idx] = _sources[idx].handle.futex->load(std::memory_order_seq_cst);
+    }
+    bool ready = false;
+    for (const auto& source : _sources) {
+      if (source.has_new_data()) {
+        ready = true;
+        break;
+      }
+    }
+    if (!ready) {
+      futex_wait_any(_futex_words, _futex_values, deadline);
+    }
+    for (const auto& source : _sources) {
+      source.handle.num_waiters->fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+ private:
+  std::vector<Source> _sources;
+  std::vector<std::atomic<std::uint32_t>*> _futex_words;
+  std::vector<std::uint32_t> _futex_values;
+  std::vector<std::size_t> _ready;
+};
+
+}  // namespace ipcpp::event
@@ -11,6 +11,9 @@
 #include <ipcpp/utils/mutex.h>
 #include <ipcpp/utils/logging.h>
 
+#include <atomic>
+#include <optional>
+
 namespace ipcpp::ps {
 
 template <typename T_p>
@@ -126,6 +129,8 @@ class Message {
 
   [[nodiscard]] std::uint64_t message_id() const { return _message_id; }
   [[nodiscard]] std::int64_t remaining_references() const { return _remaining_references.load(std::memory_order_acquire); }
+  /// true while the message is read by a subscriber or written by the publisher
+  [[nodiscard]] bool is_accessed() const { return _mutex.is_locked() || _mutex.is_locked_shared(); }
 
  private:
   shared_mutex _mutex;
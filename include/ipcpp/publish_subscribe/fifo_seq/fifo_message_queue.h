@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <ipcpp/publish_subscribe/publisher_lifecycle.h>
 #include <ipcpp/utils/numeric.h>
 #include <ipcpp/utils/logging.h>
 
@@ -34,16 +35,33 @@ class shm_message_queue {
     struct alignas(std::hardware_destructive_interference_size) {
       std::atomic_uint64_t next = 0;
       std::atomic_uint64_t last = 0;
+      /// liveness of the (Mode::Sequence) publisher, read by waiting subscribers together with next
+      PublisherLifecycle publisher;
     } message_id;
 
     /// size of the queue. Also indicates successfully initialization of the queue
     alignas(std::hardware_destructive_interference_size) std::atomic_uint64_t queue_size = 0;
     alignas(std::hardware_destructive_interference_size) std::atomic_uint64_t history_size = 0;
 
+    /// id of the next message claimed by a consumer (Mode::MessageQueue only, message_id.next is the producer side)
+    alignas(std::hardware_destructive_interference_size) std::atomic_uint64_t next_consume_id = 0;
+
+    /// publishers blocked on backpressure (BackpressurePolicy::Blocking) park on futex until subscribers consumed
+    struct alignas(std::hardware_destructive_interference_size) {
+      std::atomic<std::uint32_t> futex = 0;
+      std::atomic<std::uint32_t> num_waiting_publishers = 0;
+    } backpressure;
+
+    /// subscribers waiting for new messages (e.g. in an event::WaitSet) park on futex, publishers bump it on publish
+    struct alignas(std::hardware_destructive_interference_size) {
+      std::atomic<std::uint32_t> futex = 0;
+      std::atomic<std::uint32_t> num_waiting_subscribers = 0;
+    } notification;
+
     // in memory, here go the actual queue data if memory_layout is allocated at the beginning of the provided memory
   };
 
-  static_assert(sizeof(Header) == 256);
+  static_assert(sizeof(Header) == 7 * std::hardware_destructive_interference_size);
 
  public:
   static std::size_t required_size_bytes(const std::size_t queue_size) {
@@ -61,7 +79,11 @@ class shm_message_queue {
       return std::unexpected(std::error_code(1, std::system_category()));
     }
 
+    // a restarting publisher re-initializes the header: keep the lifecycle so that its generation keeps on counting
+    const std::uint64_t lifecycle_state =
+        reinterpret_cast<Header*>(addr)->message_id.publisher.state.load(std::memory_order_acquire);
     Header* header = std::construct_at(reinterpret_cast<Header*>(addr));
+    header->message_id.publisher.state.store(lifecycle_state, std::memory_order_relaxed);
 
     std::uint64_t queue_size = numeric::floor_to_power_of_two((size_bytes - sizeof(Header)) / sizeof(T_p));
     std::span<T_p> queue(reinterpret_cast<T_p*>(addr + sizeof(Header)), queue_size);
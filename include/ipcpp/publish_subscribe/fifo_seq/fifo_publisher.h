@@ -10,16 +10,21 @@
 #include <ipcpp/event/notifier.h>
 #include <ipcpp/event/shm_notification_memory_layout.h>
 #include <ipcpp/publish_subscribe/error.h>
-#include <ipcpp/publish_subscribe/fifo_message.h>
-#include <ipcpp/publish_subscribe/fifo_message_queue.h>
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_message.h>
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_message_queue.h>
 #include <ipcpp/publish_subscribe/options.h>
+#include <ipcpp/publish_subscribe/rate_limiter.h>
 #include <ipcpp/shm/mapped_memory.h>
 #include <ipcpp/shm/ring_buffer.h>
 #include <ipcpp/topic.h>
 #include <ipcpp/utils/logging.h>
+#include <ipcpp/utils/mutex.h>
 #include <ipcpp/utils/numeric.h>
+#include <ipcpp/utils/utils.h>
 
+#include <atomic>
 #include <concepts>
+#include <limits>
 #include <optional>
 #include <utility>
 
@@ -44,7 +49,7 @@ class Publisher final {
 
  public:
   static std::expected<Publisher, std::error_code> create(const std::string& topic_id,
-                                                          const ps::publisher::Options& options) {
+                                                          const ps::Options<ps::Mode::Sequence>& options) {
     auto e_topic = get_shm_entry(topic_id, numeric::ceil_to_power_of_two(options.queue_capacity * sizeof(T_Data)));
     if (!e_topic) {
       return std::unexpected(e_topic.error());
@@ -124,7 +129,8 @@ class Publisher final {
   }
 
  private:
-  Publisher(Topic&& topic, const ps::publisher::Options& options) : _topic(std::move(topic)), _options(options) {}
+  Publisher(std::shared_ptr<ShmRegistryEntry>&& topic, const ps::Options<ps::Mode::Sequence>& options)
+      : _topic(std::move(topic)), _options(options) {}
 
  private:
   std::error_code _m_initialize_notifier() {
@@ -143,9 +149,9 @@ class Publisher final {
   void _m_notify_observers(std::size_t index) { _notifier->notify_observers(index); }
 
  private:
-  Topic _topic = nullptr;
+  std::shared_ptr<ShmRegistryEntry> _topic = nullptr;
   std::unique_ptr<ps::shm_message_queue<data_access_type>> _message_queue = nullptr;
-  ps::publisher::Options _options;
+  ps::Options<ps::Mode::Sequence> _options;
   std::unique_ptr<notifier_type> _notifier = nullptr;
 };
 
@@ -160,7 +166,7 @@ class Publisher<T_Data, internal::ShmDefaultNotifier> final {
 
  public:
   static std::expected<Publisher, std::error_code> create(const std::string& topic_id,
-                                                          const ps::publisher::Options& options = {}) {
+                                                          const ps::Options<ps::Mode::Sequence>& options = {}) {
     auto e_topic = get_shm_entry(
         topic_id, numeric::ceil_to_power_of_two(
                       ps::shm_message_queue<data_access_type>::required_size_bytes(options.queue_capacity)));
@@ -175,6 +181,10 @@ class Publisher<T_Data, internal::ShmDefaultNotifier> final {
 
     Publisher self(std::move(e_topic.value()), options);
     self._message_queue = std::make_unique<ps::shm_message_queue<data_access_type>>(std::move(e_message_queue.value()));
+    auto* header = self._message_queue->header();
+    self._lifecycle = ps::internal::PublisherLifecycleGuard(
+        &header->message_id.publisher, &header->notification.futex,
+        ps::PublisherLifecycle::generation(header->message_id.publisher.state.load(std::memory_order_acquire)) + 1);
 
     return self;
   }
@@ -236,98 +246,172 @@ class Publisher<T_Data, internal::ShmDefaultNotifier> final {
   }
   */
 
+  /**
+   * @brief Construct a message in the next slot of the queue. If the slot still holds a message that was not consumed by
+   *  all subscribers, the options backpressure_policy decides:
+   *   - Blocking:      park until subscribers consumed it
+   *   - ReturnError:   return std::errc::no_buffer_space
+   *   - ReplaceOldest: overwrite it (lagging subscribers skip it)
+   *
+   *  With Options::publish_interval set, subscribers are notified at most once per interval: messages published within
+   *  the interval are written to the same (not yet visible) slot, so only the latest one is published by the first
+   *  publish() after the interval elapsed, by flush_if_due() or by flush().
+   */
   template <typename... T_Args>
   std::error_code publish(T_Args&&... args) {
-    if (_m_publish(std::forward<T_Args>(args)...)) {
-      return {};
+    return _m_publish(std::forward<T_Args>(args)...);
+  }
+
+  /**
+   * @brief Publish the pending (coalesced) message if the current publish interval elapsed.
+   * @return true if a message was published
+   */
+  bool flush_if_due() {
+    if (!_has_pending || !_rate_limiter.try_acquire()) {
+      return false;
+    }
+    _m_publish_pending();
+    return true;
+  }
+
+  /**
+   * @brief Publish the pending (coalesced) message immediately, regardless of the publish interval.
+   * @return true if a message was published
+   */
+  bool flush() {
+    if (!_has_pending) {
+      return false;
     }
-    return std::error_code(static_cast<int>(publisher::error_t::unknown_error), publisher::error_category());
+    _rate_limiter.reset();
+    _m_publish_pending();
+    return true;
   }
 
+  /// true if a message was published within the current interval and is not yet visible to subscribers
+  [[nodiscard]] bool has_pending() const { return _has_pending; }
+
  private:
-  Publisher(Topic&& topic, const ps::publisher::Options& options) : _topic(std::move(topic)), _options(options) {}
+  Publisher(std::shared_ptr<ShmRegistryEntry>&& topic, const ps::Options<ps::Mode::Sequence>& options)
+      : _topic(std::move(topic)), _options(options), _rate_limiter(options.publish_interval) {}
 
   [[nodiscard]] std::size_t _m_num_observers() const {
     return _message_queue->header()->num_subscribers.load(std::memory_order_acquire);
   }
 
   void _m_notify_observers(std::size_t index) {
-    _message_queue->header()->message_id.next.store(index, std::memory_order_release);
+    auto* header = _message_queue->header();
+    // seq_cst pairs with event::WaitSet: either the waiter sees the new id or we see it waiting
+    header->message_id.next.store(index, std::memory_order_seq_cst);
+    if (header->notification.num_waiting_subscribers.load(std::memory_order_seq_cst) > 0) [[unlikely]] {
+      header->notification.futex.fetch_add(1, std::memory_order_release);
+      futex_wake(header->notification.futex);
+    }
     logging::info("Publisher<'{}'>::_m_notify_observers(): message_id: {}", this->_topic->id(), index);
   }
 
-  std::uint64_t _m_handle_backpressure(std::uint64_t msg_id) {
-    auto& message_chunk = _message_queue->operator[](msg_id);
-    if (message_chunk.message_id() == std::numeric_limits<std::uint64_t>::max()) {
-      // no backpressure, chunk was never used before
-      logging::debug("Publisher<'{}'>::_m_handle_backpressure: chunk was never used", _topic->id());
-      return msg_id;
-    } else {
-      std::uint64_t remaining_references = message_chunk.remaining_references();
-      logging::debug("Publisher<'{}'>::_m_handle_backpressure: remaining references: {}", _topic->id(),
-                     remaining_references);
-      if (remaining_references <= 0) {
-        // no backpressure, chunk was read by all subscribers
-        logging::debug("Publisher<'{}'>::_m_handle_backpressure: chunk is free", _topic->id());
-        return msg_id;
-      } else {
-        logging::info("Publisher<'{}'>::publish(): Backpressure for message id: {}", this->_topic->id(), msg_id);
-        switch (_options.backpressure_policy) {
-          case ps::publisher::BackpressurePolicy::block: {
-            const std::size_t history_size = this->_options.history_capacity;
-            remaining_references = message_chunk.remaining_references();
-            while (true) {
-              if (remaining_references <= 0) {
-                break;
-              }
-              std::this_thread::yield();
-              remaining_references = message_chunk.remaining_references();
-            }
-            return msg_id;
+  /// true if the message was never published or was consumed by all subscribers that were subscribed at publish time
+  [[nodiscard]] static bool _m_is_consumed(const data_access_type& message) {
+    return message.message_id() == std::numeric_limits<std::uint64_t>::max() || message.remaining_references() <= 0;
+  }
+
+  /**
+   * @brief Acquire write access to the slot of msg_id according to the backpressure policy.
+   * @return write access or std::nullopt if the policy is BackpressurePolicy::ReturnError and the slot is not free
+   */
+  std::optional<typename data_access_type::template Access<AccessMode::WRITE>> _m_handle_backpressure(
+      std::uint64_t msg_id, const ps::BackpressurePolicy policy) {
+    auto& message = _message_queue->operator[](msg_id);
+    switch (policy) {
+      case ps::BackpressurePolicy::ReturnError: {
+        if (!_m_is_consumed(message)) {
+          logging::debug("Publisher<'{}'>::publish(): Backpressure for message id: {}", _topic->id(), msg_id);
+          return std::nullopt;
+        }
+        return message.request_writable();
+      }
+      case ps::BackpressurePolicy::ReplaceOldest: {
+        // unread messages are overwritten: only wait for subscribers that are reading the slot right now
+        for (uint_t iteration = 0;; ++iteration) {
+          if (auto o_access = message.request_writable(); o_access) {
+            return o_access;
           }
-          case ps::publisher::BackpressurePolicy::remove_oldest: {
-            logging::debug(
-                "Publisher<'{}'>::publish(): resetting message #{} as part of backpressure strategy (remove_oldest)",
-                this->_topic->id(), msg_id);
-            for (std::size_t i = 0; i < _message_queue->size(); ++i) {
-              if (auto access = _message_queue->operator[](msg_id + i).request_writable(); access) {
-                access.value().reset();
-                logging::debug("Publisher<'{}'>::publish(): message #{} reset", this->_topic->id(), msg_id + i);
-                return msg_id + i;
-              }
+          _m_wait(iteration, [&message]() { return !message.is_accessed(); });
+        }
+      }
+      case ps::BackpressurePolicy::Blocking: {
+        for (uint_t iteration = 0;; ++iteration) {
+          if (_m_is_consumed(message)) {
+            if (auto o_access = message.request_writable(); o_access) {
+              return o_access;
             }
-            logging::debug("Publisher<'{}'>::publish(): failed to handle backpressure", this->_topic->id());
-            return std::numeric_limits<std::uint64_t>::max();
           }
-          default:
-            std::unreachable();
+          _m_wait(iteration, [&message]() { return _m_is_consumed(message) && !message.is_accessed(); });
         }
       }
+      default:
+        std::unreachable();
     }
   }
 
+  /**
+   * @brief Spin for the first iterations, park on the backpressure futex afterward. Subscribers wake parked publishers
+   *  after consuming messages.
+   */
+  template <typename F>
+  void _m_wait(uint_t iteration, F&& slot_available) {
+    if (iteration < _spin_iterations) {
+      utils::cpu_relax();
+      return;
+    }
+    auto& backpressure = _message_queue->header()->backpressure;
+    backpressure.num_waiting_publishers.fetch_add(1, std::memory_order_seq_cst);
+    // pairs with the fence in Subscriber::_m_notify_publishers: either it sees us waiting or we see the slot released
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::uint32_t futex_value = backpressure.futex.load(std::memory_order_acquire);
+    if (!slot_available()) {
+      futex_wait(backpressure.futex, futex_value);
+    }
+    backpressure.num_waiting_publishers.fetch_sub(1, std::memory_order_release);
+  }
+
+  void _m_publish_pending() {
+    _has_pending = false;
+    _m_notify_observers(_message_queue->header()->message_id.next.load(std::memory_order_acquire) + 1);
+  }
+
   template <typename... T_Args>
-  bool _m_publish(T_Args&&... args) {
+  std::error_code _m_publish(T_Args&&... args) {
     auto msg_id = _message_queue->header()->message_id.next.load(std::memory_order_acquire);
-    // msg_id = _m_handle_backpressure(msg_id);
-    bool published = false;
-    if (auto o_access = _message_queue->operator[](msg_id).request_writable(); o_access) {
-      o_access->emplace(_m_num_observers(), msg_id, std::forward<T_Args>(args)...);
-      published = true;
+    // a pending message occupies the slot already: it is not visible to subscribers and may simply be replaced
+    auto o_access = _m_handle_backpressure(
+        msg_id, _has_pending ? ps::BackpressurePolicy::ReplaceOldest : _options.backpressure_policy);
+    if (!o_access) {
+      return std::make_error_code(std::errc::no_buffer_space);
     }
-    if (published) {
-      // o_access must be released at this point
-      _m_notify_observers(msg_id + 1);
-      logging::debug("Publisher<'{}'>::publish(): published message (#{}) at {}", _topic->id(), msg_id, msg_id);
-      return true;
+    o_access.value().emplace(_m_num_observers(), msg_id, std::forward<T_Args>(args)...);
+    // o_access must be released before subscribers are notified
+    o_access.reset();
+    if (!_rate_limiter.try_acquire()) {
+      _has_pending = true;
+      return {};
     }
-    return false;
+    _has_pending = false;
+    _m_notify_observers(msg_id + 1);
+    logging::debug("Publisher<'{}'>::publish(): published message (#{}) at {}", _topic->id(), msg_id, msg_id);
+    return {};
   }
 
  private:
-  Topic _topic = nullptr;
+  static constexpr uint_t _spin_iterations = 2048;
+
+  std::shared_ptr<ShmRegistryEntry> _topic = nullptr;
   std::unique_ptr<ps::shm_message_queue<data_access_type>> _message_queue = nullptr;
-  ps::publisher::Options _options;
+  ps::Options<ps::Mode::Sequence> _options;
+  ps::internal::NotificationRateLimiter _rate_limiter;
+  /// the slot of message_id.next holds a message published within the current interval
+  bool _has_pending = false;
+  /// marks this publisher alive in the header, marks it down and wakes waiting subscribers on destruction
+  ps::internal::PublisherLifecycleGuard _lifecycle;
 };
 
 }  // namespace ipcpp::publish_subscribe
\ No newline at end of file
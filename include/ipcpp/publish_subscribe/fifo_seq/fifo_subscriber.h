@@ -10,13 +10,17 @@
 #include <ipcpp/event/observer.h>
 #include <ipcpp/event/shm_notification_memory_layout.h>
 #include <ipcpp/publish_subscribe/error.h>
-#include <ipcpp/publish_subscribe/fifo_message.h>
-#include <ipcpp/publish_subscribe/fifo_message_queue.h>
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_message.h>
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_message_queue.h>
 #include <ipcpp/publish_subscribe/options.h>
 #include <ipcpp/shm/mapped_memory.h>
 #include <ipcpp/topic.h>
 #include <ipcpp/utils/logging.h>
+#include <ipcpp/utils/mutex.h>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <string>
 
 namespace ipcpp::publish_subscribe {
@@ -36,7 +40,7 @@ class Subscriber final {
 
  public:
   static std::expected<Subscriber, std::error_code> create(const std::string& topic_id,
-                                                           const ps::subscriber::Options& options) {
+                                                           const ps::SubscriberOptions<ps::Mode::Sequence>& options) {
     auto e_topic = get_shm_entry(topic_id);
     if (!e_topic) {
       return std::unexpected(e_topic.error());
@@ -77,12 +81,12 @@ class Subscriber final {
   }
 
  private:
-  Subscriber(Topic&& topic, const ps::subscriber::Options& options) : _topic(std::move(topic)), _options(options) {}
+  Subscriber(std::shared_ptr<ShmRegistryEntry>&& topic, const ps::SubscriberOptions<ps::Mode::Sequence>& options) : _topic(std::move(topic)), _options(options) {}
 
  private:
-  Topic _topic = nullptr;
+  std::shared_ptr<ShmRegistryEntry> _topic = nullptr;
   std::unique_ptr<ps::shm_message_queue<data_access_type>> _message_queue = nullptr;
-  ps::subscriber::Options _options;
+  ps::SubscriberOptions<ps::Mode::Sequence> _options;
   std::unique_ptr<observer_type> _observer = nullptr;
 };
 
@@ -94,7 +98,7 @@ class Subscriber<T_Data, internal::ShmDefault> final {
 
  public:
   static std::expected<Subscriber, std::error_code> create(const std::string& topic_id,
-                                                           const ps::subscriber::Options& options = {}) {
+                                                           const ps::SubscriberOptions<ps::Mode::Sequence>& options = {}) {
     auto e_topic = get_shm_entry(topic_id);
     if (!e_topic) {
       return std::unexpected(e_topic.error());
@@ -109,23 +113,49 @@ class Subscriber<T_Data, internal::ShmDefault> final {
     return self;
   }
 
+  /**
+   * @brief Spin until the publisher published a message that was not received yet.
+   *
+   *  The publishers lifecycle word shares the cache line of message_id.next: a publisher shutdown is detected without
+   *  any syscall, a crashed publisher every _liveness_check_iterations iterations. If the publisher restarted (next
+   *  generation), the subscription is renewed and messages of the former publisher are dropped.
+   *
+   * @return the published head or std::numeric_limits<std::uint64_t>::max() if the publisher is down
+   */
   std::uint64_t _m_wait_for_data() {
-    while (true) {
-      if (auto new_msg_id = _message_queue.header()->message_id.next.load(std::memory_order_acquire); new_msg_id != _next_message_id) {
+    auto& message_id = _message_queue.header()->message_id;
+    for (std::uint64_t iteration = 1;; ++iteration) {
+      const std::uint64_t lifecycle_state = message_id.publisher.state.load(std::memory_order_acquire);
+      if (ps::PublisherLifecycle::generation(lifecycle_state) != _publisher_generation) [[unlikely]] {
+        if (!ps::PublisherLifecycle::is_alive(lifecycle_state)) {
+          return std::numeric_limits<std::uint64_t>::max();
+        }
+        logging::info("Subscriber<'{}'>: publisher restarted, renewing subscription", _topic->id());
+        subscribe();
+        continue;
+      }
+      if (auto new_msg_id = message_id.next.load(std::memory_order_acquire); new_msg_id > _next_message_id) {
         return new_msg_id;
       }
-      // std::this_thread::yield();
+      if (!ps::PublisherLifecycle::is_alive(lifecycle_state)) [[unlikely]] {
+        return std::numeric_limits<std::uint64_t>::max();
+      }
+      if (iteration % _liveness_check_iterations == 0 && !message_id.publisher.check_process_alive()) [[unlikely]] {
+        return std::numeric_limits<std::uint64_t>::max();
+      }
     }
   }
 
-  std::error_code receive(std::function<std::error_code(const T_Data&)> callback) {
+  template <typename F>
+    requires std::is_invocable_r_v<std::error_code, F, const T_Data&>
+  std::error_code receive(F&& callback) {
     std::uint64_t received_message_number = _m_wait_for_data();
-    std::uint64_t msg_id = _next_message_id;
-    _next_message_id++;
     if (received_message_number == std::numeric_limits<std::uint64_t>::max()) {
       logging::warn("Subscriber<'{}'>::receive(): Publisher down", _topic->id());
-      return {1, std::system_category()};
+      return std::make_error_code(std::errc::owner_dead);
     }
+    std::uint64_t msg_id = _next_message_id;
+    _next_message_id++;
     auto& wrapped_message = _message_queue.operator[](msg_id);
     logging::debug("Subscriber<'{}'>::receive(): received next message: assumed #{}, actual #{}", _topic->id(),
                    msg_id, wrapped_message.message_id());
@@ -139,11 +169,68 @@ class Subscriber<T_Data, internal::ShmDefault> final {
       logging::debug("Subscriber<'{}'>::receive(): data not consumed", _topic->id());
       return {3, std::system_category()};
     }
-    return callback(*o_data.value());
+    std::error_code error = callback(*o_data.value());
+    o_data.reset();
+    _m_notify_publishers();
+    return error;
+  }
+
+  /**
+   * @brief Blocks until at least one message is available and passes up to max_messages available messages to callback.
+   *  The published head is loaded once per batch, messages that were overwritten or cannot be consumed anymore are
+   *  skipped.
+   *
+   * @return number of messages passed to callback or the first error returned by callback
+   */
+  template <typename F>
+    requires std::is_invocable_r_v<std::error_code, F, const T_Data&>
+  std::expected<std::size_t, std::error_code> receive_batch(const std::size_t max_messages, F&& callback) {
+    const std::uint64_t published_head = _m_wait_for_data();
+    if (published_head == std::numeric_limits<std::uint64_t>::max()) {
+      logging::warn("Subscriber<'{}'>::receive_batch(): Publisher down", _topic->id());
+      return std::unexpected(std::make_error_code(std::errc::owner_dead));
+    }
+    const std::uint64_t batch_end = _next_message_id + std::min<std::uint64_t>(published_head - _next_message_id,
+                                                                                 max_messages);
+    std::size_t num_received = 0;
+    for (; _next_message_id < batch_end; ++_next_message_id) {
+      auto& wrapped_message = _message_queue.operator[](_next_message_id);
+      if (wrapped_message.message_id() != _next_message_id) [[unlikely]] {
+        logging::error("Subscriber<'{}'>::receive_batch(): skipping message #{}: message number mismatch (actual: {})",
+                       _topic->id(), _next_message_id, wrapped_message.message_id());
+        continue;
+      }
+      auto o_data = wrapped_message.consume();
+      if (!o_data) [[unlikely]] {
+        logging::debug("Subscriber<'{}'>::receive_batch(): message #{} not consumed", _topic->id(), _next_message_id);
+        continue;
+      }
+      if (auto error = std::invoke(callback, *o_data.value()); error) {
+        ++_next_message_id;
+        o_data.reset();
+        _m_notify_publishers();
+        return std::unexpected(error);
+      }
+      ++num_received;
+    }
+    _m_notify_publishers();
+    return num_received;
+  }
+
+  /// true if receive() would not have to wait for a new message
+  [[nodiscard]] bool has_new_data() {
+    return _message_queue.header()->message_id.next.load(std::memory_order_seq_cst) != _next_message_id;
+  }
+
+  /// futex word publishers of this topic bump on publish (used by event::WaitSet)
+  [[nodiscard]] FutexWaitHandle wait_handle() {
+    auto& notification = _message_queue.header()->notification;
+    return {&notification.futex, &notification.num_waiting_subscribers};
   }
 
   void subscribe() {
     _message_queue.header()->num_subscribers.fetch_add(1, std::memory_order_release);
+    _publisher_generation = _m_publisher_generation();
     _next_message_id = _message_queue.header()->message_id.next.load(std::memory_order_acquire);
   }
 
@@ -154,13 +241,39 @@ class Subscriber<T_Data, internal::ShmDefault> final {
   }
 
  private:
-  Subscriber(Topic&& topic, const ps::subscriber::Options& options, ps::shm_message_queue<data_access_type>&& mq) : _topic(std::move(topic)), _options(options), _message_queue(std::move(mq)) {}
+  Subscriber(std::shared_ptr<ShmRegistryEntry>&& topic, const ps::SubscriberOptions<ps::Mode::Sequence>& options,
+             ps::shm_message_queue<data_access_type>&& mq)
+      : _topic(std::move(topic)), _options(options), _message_queue(std::move(mq)) {
+    _publisher_generation = _m_publisher_generation();
+  }
+
+  [[nodiscard]] std::uint64_t _m_publisher_generation() {
+    return ps::PublisherLifecycle::generation(
+        _message_queue.header()->message_id.publisher.state.load(std::memory_order_acquire));
+  }
+
+  /**
+   * @brief Wake publishers that are parked on backpressure (BackpressurePolicy::Blocking) after messages were consumed.
+   */
+  void _m_notify_publishers() {
+    auto& backpressure = _message_queue.header()->backpressure;
+    // pairs with the fence in Publisher::_m_wait: either we see the publisher waiting or it sees the released slot
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (backpressure.num_waiting_publishers.load(std::memory_order_relaxed) > 0) [[unlikely]] {
+      backpressure.futex.fetch_add(1, std::memory_order_release);
+      futex_wake(backpressure.futex);
+    }
+  }
 
  private:
-  Topic _topic = nullptr;
+  std::shared_ptr<ShmRegistryEntry> _topic = nullptr;
   ps::shm_message_queue<data_access_type> _message_queue = nullptr;
-  ps::subscriber::Options _options;
+  ps::SubscriberOptions<ps::Mode::Sequence> _options;
   std::uint64_t _next_message_id = 0;
+  /// generation of the publisher at subscription (see ps::PublisherLifecycle)
+  std::uint64_t _publisher_generation = 0;
+  /// spins between two checks if the publisher process crashed (one syscall each)
+  static constexpr std::uint64_t _liveness_check_iterations = std::uint64_t(1) << 20;
 };
 
 }  // namespace ipcpp::publish_subscribe
\ No newline at end of file
@@ -0,0 +1,115 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_message_queue.h>
+#include <ipcpp/publish_subscribe/message_queue/message_queue_slot.h>
+#include <ipcpp/publish_subscribe/options.h>
+#include <ipcpp/topic.h>
+#include <ipcpp/utils/numeric.h>
+#include <ipcpp/utils/utils.h>
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace ipcpp::ps {
+
+/**
+ * @brief Producer of a MessageQueue topic: each published message is consumed by exactly one MessageQueueSubscriber
+ *  (work distribution). Any number of publishers and subscribers may share a topic, none of them takes a lock.
+ */
+template <typename T_p>
+class MessageQueuePublisher {
+ public:
+  typedef T_p value_type;
+  typedef mq::Slot<T_p> message_type;
+  typedef shm_message_queue<message_type> queue_type;
+
+ public:
+  static std::expected<MessageQueuePublisher, std::error_code> create(const std::string& topic_id,
+                                                                      Options<Mode::MessageQueue> options = {}) {
+    auto e_topic =
+        get_shm_entry(topic_id, queue_type::required_size_bytes(numeric::ceil_to_power_of_two(options.queue_capacity)));
+    if (!e_topic) {
+      return std::unexpected(e_topic.error());
+    }
+    auto e_queue = queue_type::read_at(e_topic.value()->shm().addr());
+    if (!e_queue) {
+      e_queue = queue_type::init_at(e_topic.value()->shm().addr(), e_topic.value()->shm().size());
+    }
+    if (!e_queue) {
+      return std::unexpected(e_queue.error());
+    }
+    return MessageQueuePublisher(std::move(e_topic.value()), std::move(e_queue.value()), options);
+  }
+
+ public:
+  /**
+   * @brief Construct a message in the next free cell of the queue. If the queue is full, the options
+   *  backpressure_policy decides whether to wait for a consumer, to return std::errc::no_buffer_space or to drop the
+   *  oldest message that is not yet claimed by a consumer.
+   */
+  template <typename... T_Args>
+    requires std::is_constructible_v<T_p, T_Args...>
+  std::error_code publish(T_Args&&... args) {
+    std::optional<std::uint64_t> id;
+    for (uint_t iteration = 0; !(id = mq::claim(_queue, _queue.header()->message_id.next, 0)); ++iteration) {
+      switch (_options.backpressure_policy) {
+        case BackpressurePolicy::ReturnError:
+          return std::make_error_code(std::errc::no_buffer_space);
+        case BackpressurePolicy::ReplaceOldest:
+          _m_drop_oldest();
+          break;
+        case BackpressurePolicy::Blocking:
+          if (iteration < _spin_iterations) {
+            utils::cpu_relax();
+          } else {
+            std::this_thread::yield();
+          }
+          break;
+      }
+    }
+    message_type& message = _queue[*id];
+    message.emplace(std::forward<T_Args>(args)...);
+    message.set_sequence(*id & (_queue.size() - 1), *id + 1);
+    logging::debug("MessageQueuePublisher<'{}'>::publish: published message #{}", _topic->id(), *id);
+    return {};
+  }
+
+  [[nodiscard]] std::size_t capacity() const { return _queue.size(); }
+
+ private:
+  MessageQueuePublisher(std::shared_ptr<ShmRegistryEntry>&& topic, queue_type&& queue,
+                        const Options<Mode::MessageQueue>& options)
+      : _topic(std::move(topic)), _queue(std::move(queue)), _options(options) {}
+
+  /**
+   * @brief Claim the oldest message like a consumer would and discard it.
+   */
+  void _m_drop_oldest() {
+    if (auto id = mq::claim(_queue, _queue.header()->next_consume_id, 1)) {
+      message_type& message = _queue[*id];
+      message.reset();
+      message.set_sequence(*id & (_queue.size() - 1), *id + _queue.size());
+      logging::debug("MessageQueuePublisher<'{}'>::publish: dropped message #{}", _topic->id(), *id);
+    }
+  }
+
+ private:
+  static constexpr uint_t _spin_iterations = 2048;
+
+  /// the full shared memory entry to ensure its validity
+  std::shared_ptr<ShmRegistryEntry> _topic = nullptr;
+  queue_type _queue;
+  Options<Mode::MessageQueue> _options;
+};
+
+}  // namespace ipcpp::ps
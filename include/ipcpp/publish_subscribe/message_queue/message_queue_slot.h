@@ -0,0 +1,92 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_message_queue.h>
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+namespace ipcpp::ps::mq {
+
+/**
+ * @brief Cell of a bounded MPMC queue (D. Vyukov) living in a shm_message_queue. The sequence number of a cell encodes
+ *  its state for the message id it is accessed with:
+ *   - sequence == id:                  free, the producer of message id may claim it
+ *   - sequence == id + 1:              written, the consumer of message id may claim it
+ *   - sequence == id + queue_size:     consumed, free for the producer of the next lap
+ *
+ *  Sequence numbers are stored relative to the cells index within the queue so that default constructed cells are
+ *  valid (free for the first lap) without initializing each cell with its own index.
+ */
+template <typename T_p>
+class Slot {
+ public:
+  typedef T_p value_type;
+
+ public:
+  Slot() = default;
+  ~Slot() = default;
+
+  Slot(const Slot&) = delete;
+  Slot& operator=(const Slot&) = delete;
+  Slot(Slot&&) = delete;
+  Slot& operator=(Slot&&) = delete;
+
+  /// signed distance between the cells sequence and `expected`, index is the cells index in the queue
+  [[nodiscard]] std::int64_t sequence_diff(std::uint64_t index, std::uint64_t expected) const {
+    return static_cast<std::int64_t>(_sequence.load(std::memory_order_acquire) + index - expected);
+  }
+
+  void set_sequence(std::uint64_t index, std::uint64_t sequence) {
+    _sequence.store(sequence - index, std::memory_order_release);
+  }
+
+  template <typename... T_Args>
+  void emplace(T_Args&&... args) {
+    _opt_value.emplace(std::forward<T_Args>(args)...);
+  }
+
+  void reset() { _opt_value.reset(); }
+
+  T_p& value() { return _opt_value.value(); }
+  const T_p& value() const { return _opt_value.value(); }
+
+ private:
+  std::atomic<std::uint64_t> _sequence = 0;
+  std::optional<T_p> _opt_value = std::nullopt;
+};
+
+/**
+ * @brief Claim the cell of the next message id of the queue. Producers claim via header().message_id.next and a
+ *  sequence == id, consumers via header().next_consume_id and a sequence == id + 1.
+ * @return the claimed message id or std::nullopt if the queue is full (producers) or empty (consumers)
+ */
+template <typename T_p>
+std::optional<std::uint64_t> claim(shm_message_queue<Slot<T_p>>& queue, std::atomic_uint64_t& position,
+                                   std::uint64_t sequence_offset) {
+  const std::uint64_t mask = queue.size() - 1;
+  std::uint64_t id = position.load(std::memory_order_relaxed);
+  while (true) {
+    std::int64_t diff = queue[id].sequence_diff(id & mask, id + sequence_offset);
+    if (diff == 0) {
+      // single CAS claims the cell, on failure id is updated to the current position
+      if (position.compare_exchange_weak(id, id + 1, std::memory_order_relaxed)) {
+        return id;
+      }
+    } else if (diff < 0) {
+      return std::nullopt;
+    } else {
+      // another thread claimed id already
+      id = position.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+}  // namespace ipcpp::ps::mq
@@ -0,0 +1,139 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_message_queue.h>
+#include <ipcpp/publish_subscribe/message_queue/message_queue_slot.h>
+#include <ipcpp/publish_subscribe/options.h>
+#include <ipcpp/topic.h>
+#include <ipcpp/utils/utils.h>
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace ipcpp::ps {
+
+/**
+ * @brief Consumer of a MessageQueue topic: subscribers compete for messages, each message is handed out to exactly one
+ *  of them.
+ */
+template <typename T_p>
+class MessageQueueSubscriber {
+ public:
+  typedef T_p value_type;
+  typedef mq::Slot<T_p> message_type;
+  typedef shm_message_queue<message_type> queue_type;
+
+ public:
+  /**
+   * @brief Read access to a claimed message. The cell is handed back to the publishers when the Message is destroyed.
+   *
+   * @attention A claimed message blocks its cell: keep it only as long as needed, publishers wrap around to it after
+   *  capacity() messages.
+   */
+  class Message {
+    friend class MessageQueueSubscriber;
+
+   public:
+    ~Message() { release(); }
+
+    Message(const Message&) = delete;
+    Message& operator=(const Message&) = delete;
+    Message(Message&& other) noexcept : _queue(other._queue), _id(other._id) { other._queue = nullptr; }
+    Message& operator=(Message&& other) noexcept {
+      if (this != &other) {
+        release();
+        _queue = other._queue;
+        _id = other._id;
+        other._queue = nullptr;
+      }
+      return *this;
+    }
+
+    void release() {
+      if (_queue == nullptr) {
+        return;
+      }
+      message_type& message = (*_queue)[_id];
+      message.reset();
+      message.set_sequence(_id & (_queue->size() - 1), _id + _queue->size());
+      _queue = nullptr;
+    }
+
+    const T_p* operator->() const { return &(*_queue)[_id].value(); }
+    const T_p& operator*() const { return (*_queue)[_id].value(); }
+
+    [[nodiscard]] std::uint64_t id() const { return _id; }
+
+   private:
+    Message(queue_type* queue, std::uint64_t id) : _queue(queue), _id(id) {}
+
+    queue_type* _queue = nullptr;
+    std::uint64_t _id = 0;
+  };
+
+ public:
+  static std::expected<MessageQueueSubscriber, std::error_code> create(const std::string& topic_id) {
+    auto e_topic = get_shm_entry(topic_id);
+    if (!e_topic) {
+      return std::unexpected(e_topic.error());
+    }
+    auto e_queue = queue_type::read_at(e_topic.value()->shm().addr());
+    if (!e_queue) {
+      return std::unexpected(e_queue.error());
+    }
+    return MessageQueueSubscriber(std::move(e_topic.value()), std::move(e_queue.value()));
+  }
+
+ public:
+  /**
+   * @brief Claim the oldest message that is not yet claimed by another subscriber.
+   * @return the message or std::errc::no_message_available if the queue is empty
+   */
+  std::expected<Message, std::error_code> fetch_message() {
+    auto id = mq::claim(*_queue, _queue->header()->next_consume_id, 1);
+    if (!id) {
+      return std::unexpected(std::make_error_code(std::errc::no_message_available));
+    }
+    logging::debug("MessageQueueSubscriber<'{}'>::fetch_message: claimed message #{}", _topic->id(), *id);
+    return Message(_queue.get(), *id);
+  }
+
+  /**
+   * @brief Block until a message could be claimed.
+   */
+  Message await_message() {
+    for (uint_t iteration = 0;; ++iteration) {
+      if (auto e_message = fetch_message(); e_message) {
+        return std::move(e_message.value());
+      }
+      if (iteration < _spin_iterations) {
+        utils::cpu_relax();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+ private:
+  MessageQueueSubscriber(std::shared_ptr<ShmRegistryEntry>&& topic, queue_type&& queue)
+      : _topic(std::move(topic)), _queue(std::make_unique<queue_type>(std::move(queue))) {}
+
+ private:
+  static constexpr uint_t _spin_iterations = 2048;
+
+  /// the full shared memory entry to ensure its validity
+  std::shared_ptr<ShmRegistryEntry> _topic = nullptr;
+  /// heap allocated so that Messages stay valid when the subscriber is moved
+  std::unique_ptr<queue_type> _queue;
+};
+
+}  // namespace ipcpp::ps
@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <ipcpp/shm/mapping_options.h>
 #include <ipcpp/types.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 
 using namespace std::chrono_literals;
@@ -33,6 +35,25 @@ enum class BackpressurePolicy {
   ReplaceOldest,  // oldest message not occupied is overwritten
 };
 
+/**
+ * Strategy of subscribers that block until a new message is available: busy spin for spin_iterations, yield the CPU
+ * for another yield_iterations and finally park (futex) until a publisher wakes them up.
+ */
+struct WaitStrategy {
+  uint_t spin_iterations = 2048;
+  uint_t yield_iterations = 64;
+  /// if false, subscribers keep on yielding instead of parking
+  bool park = true;
+};
+
+/**
+ * Defines how RealTime subscribers choose between new messages of multiple publishers (max_publishers > 1).
+ */
+enum class PublisherMergePolicy {
+  Newest,      // the message published last (by timestamp) wins, older messages of other publishers are skipped
+  RoundRobin,  // publishers with new messages are served in turns
+};
+
 template <Mode T_p>
 struct Options;
 
@@ -41,8 +62,51 @@ struct Options<Mode::RealTime> {
   uint_half_t max_publishers = 1;
   uint_half_t max_subscribers = 1;
   uint_half_t max_concurrent_acquires = 1;
+  /// topic wide limit of concurrently acquired messages (0: max_subscribers * max_concurrent_acquires). Publisher pools
+  ///  only need to hold max_total_acquires + 3 messages, a lower limit shrinks them.
+  uint_half_t max_total_acquires = 0;
+  /// publisher local: if not 0, subscribers are notified at most once per interval. Messages published within an
+  ///  interval are coalesced, only the latest one is published (see RealTimePublisher::flush).
+  std::chrono::nanoseconds publish_interval = 0ns;
+  /// applied by the publisher that creates the topic segment (e.g. numa placement near the hot subscriber)
+  shm::MappingOptions mapping_options{};
+};
+
+template <>
+struct Options<Mode::Sequence> {
+  /// minimum number of messages the queue can hold
+  std::size_t queue_capacity = 1024;
+  /// applies if the next slot still holds a message that was not consumed by all subscribers (or is currently read)
+  BackpressurePolicy backpressure_policy = BackpressurePolicy::ReplaceOldest;
+  /// if not 0, subscribers are notified at most once per interval. Messages published within an interval are
+  ///  coalesced into one queue slot, only the latest one is published (see Publisher::flush).
+  std::chrono::nanoseconds publish_interval = 0ns;
 };
 
+template <>
+struct Options<Mode::MessageQueue> {
+  /// minimum number of messages the queue can hold (rounded up to a power of two by the first publisher)
+  std::size_t queue_capacity = 1024;
+  /// Blocking: wait for a consumer, ReturnError: std::errc::no_buffer_space, ReplaceOldest: drop the oldest message
+  BackpressurePolicy backpressure_policy = BackpressurePolicy::ReturnError;
+};
+
+template <Mode T_p>
+struct SubscriberOptions;
+
+template <>
+struct SubscriberOptions<Mode::RealTime> {
+  WaitStrategy wait_strategy{};
+  PublisherMergePolicy merge_policy = PublisherMergePolicy::Newest;
+  RealTimeSubscriptionMode subscription_mode = RealTimeSubscriptionMode::Volatile;
+  /// parked subscribers wake up at this interval to check if publisher processes crashed (a publisher that shuts down
+  ///  regularly is detected immediately)
+  std::chrono::milliseconds liveness_check_interval = 100ms;
+};
+
+template <>
+struct SubscriberOptions<Mode::Sequence> {};
+
 enum class InitializationState : uint_t { uninitialized = 0, in_initialization, initialized };
 
 }  // namespace ipcpp::ps
\ No newline at end of file
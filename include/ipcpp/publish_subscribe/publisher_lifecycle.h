@@ -0,0 +1,123 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/utils/mutex.h>
+#include <ipcpp/utils/system.h>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace ipcpp::ps {
+
+/**
+ * @brief Liveness word of a publisher, placed in shared memory next to the message id subscribers load anyway.
+ *
+ * state holds (generation << 1) | alive: a publisher that takes over starts the next generation, a publisher that
+ *  shuts down clears the alive bit. Subscribers that find no new message read state from the same cache line and
+ *  detect a publisher shutdown without any syscall. A crashed publisher cannot clear its bit: check_process_alive()
+ *  (one syscall) is meant for the slow path of waiting subscribers and marks the publisher down for all others.
+ */
+struct PublisherLifecycle {
+  static constexpr std::uint64_t alive_bit = 1;
+
+  std::atomic_uint64_t state = 0;
+  std::atomic_uint64_t pid = 0;
+
+  [[nodiscard]] static bool is_alive(const std::uint64_t state) { return (state & alive_bit) != 0; }
+  [[nodiscard]] static std::uint64_t generation(const std::uint64_t state) { return state >> 1; }
+
+  void set_alive(const std::uint64_t generation) {
+    pid.store(utils::system::get_pid(), std::memory_order_relaxed);
+    state.store((generation << 1) | alive_bit, std::memory_order_release);
+  }
+
+  /**
+   * @brief Mark the publisher of generation down.
+   * @return false if the state belongs to another generation (a successor took over) or is already marked down
+   */
+  bool set_down(const std::uint64_t generation) {
+    // a plain fetch_and would mark a successor that took over in the meantime down as well
+    std::uint64_t expected = (generation << 1) | alive_bit;
+    return state.compare_exchange_strong(expected, generation << 1, std::memory_order_acq_rel);
+  }
+
+  /**
+   * @brief Check if the process of an alive marked publisher still exists, mark it down otherwise.
+   * @return true if the publisher is alive
+   */
+  bool check_process_alive() {
+    std::uint64_t current = state.load(std::memory_order_acquire);
+    if (!is_alive(current)) {
+      return false;
+    }
+    if (utils::system::is_process_alive(pid.load(std::memory_order_relaxed))) {
+      return true;
+    }
+    // fails if a new publisher took over in the meantime (next generation)
+    if (state.compare_exchange_strong(current, current & ~alive_bit, std::memory_order_acq_rel)) {
+      return false;
+    }
+    return is_alive(current);
+  }
+};
+
+namespace internal {
+
+/**
+ * @brief Owned by a publisher: marks its PublisherLifecycle alive for its lifetime and wakes parked subscribers on
+ *  shutdown so that they observe it immediately.
+ */
+class PublisherLifecycleGuard {
+ public:
+  PublisherLifecycleGuard() = default;
+  PublisherLifecycleGuard(PublisherLifecycle* lifecycle, std::atomic<std::uint32_t>* notification_futex,
+                          const std::uint64_t generation)
+      : _lifecycle(lifecycle), _notification_futex(notification_futex), _generation(generation) {
+    _lifecycle->set_alive(generation);
+  }
+
+  PublisherLifecycleGuard(const PublisherLifecycleGuard&) = delete;
+  PublisherLifecycleGuard& operator=(const PublisherLifecycleGuard&) = delete;
+  PublisherLifecycleGuard(PublisherLifecycleGuard&& other) noexcept
+      : _lifecycle(std::exchange(other._lifecycle, nullptr)),
+        _notification_futex(std::exchange(other._notification_futex, nullptr)),
+        _generation(other._generation) {}
+  PublisherLifecycleGuard& operator=(PublisherLifecycleGuard&& other) noexcept {
+    if (this != &other) {
+      _m_shutdown();
+      _lifecycle = std::exchange(other._lifecycle, nullptr);
+      _notification_futex = std::exchange(other._notification_futex, nullptr);
+      _generation = other._generation;
+    }
+    return *this;
+  }
+
+  ~PublisherLifecycleGuard() { _m_shutdown(); }
+
+ private:
+  void _m_shutdown() {
+    if (_lifecycle == nullptr) {
+      return;
+    }
+    _lifecycle->set_down(_generation);
+    _notification_futex->fetch_add(1, std::memory_order_release);
+    futex_wake(*_notification_futex);
+    _lifecycle = nullptr;
+  }
+
+ private:
+  PublisherLifecycle* _lifecycle = nullptr;
+  std::atomic<std::uint32_t>* _notification_futex = nullptr;
+  std::uint64_t _generation = 0;
+};
+
+}  // namespace internal
+
+}  // namespace ipcpp::ps
@@ -0,0 +1,51 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/utils/utils.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace ipcpp::ps::internal {
+
+/**
+ * @brief Publisher local limit of subscriber notifications to one per interval (see Options::publish_interval).
+ *
+ * Purely process local: it never touches shared memory, so publishes that are coalesced cost neither cache traffic on
+ *  subscriber cache lines nor futex wakes.
+ */
+class NotificationRateLimiter {
+ public:
+  explicit NotificationRateLimiter(const std::chrono::nanoseconds interval = std::chrono::nanoseconds(0))
+      : _interval(interval.count()) {}
+
+  [[nodiscard]] bool enabled() const { return _interval > 0; }
+
+  /// true if subscribers may be notified now, starts the next interval in that case
+  bool try_acquire() {
+    if (_interval <= 0) {
+      return true;
+    }
+    const std::int64_t now = utils::timestamp();
+    if (now - _last_notification < _interval) {
+      return false;
+    }
+    _last_notification = now;
+    return true;
+  }
+
+  /// start the next interval now (used if subscribers are notified regardless of the limit, e.g. on flush)
+  void reset() { _last_notification = utils::timestamp(); }
+
+ private:
+  std::int64_t _interval = 0;
+  std::int64_t _last_notification = 0;
+};
+
+}  // namespace ipcpp::ps::internal
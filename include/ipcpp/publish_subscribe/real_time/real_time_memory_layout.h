@@ -8,6 +8,7 @@
 #pragma once
 
 #include <ipcpp/publish_subscribe/options.h>
+#include <ipcpp/publish_subscribe/publisher_lifecycle.h>
 #include <ipcpp/types.h>
 #include <ipcpp/utils/atomic.h>
 #include <ipcpp/utils/ip_lock.h>
@@ -16,7 +17,9 @@
 #include <ipcpp/utils/system.h>
 #include <ipcpp/utils/utils.h>
 
+#include <algorithm>
 #include <atomic>
+#include <bit>
 #include <chrono>
 #include <expected>
 #include <new>
@@ -36,6 +39,8 @@ struct ProcessData {
 struct RealTimeSubscriberEntry {
   alignas(std::hardware_destructive_interference_size) ProcessData process_data;
   const uint_half_t id = std::numeric_limits<uint_half_t>::max();
+  /// number of messages currently acquired by this subscriber. Written by this subscriber only.
+  alignas(std::hardware_destructive_interference_size) std::atomic<int_t> acquired_messages = 0;
 
   RealTimeSubscriberEntry() = default;
   explicit RealTimeSubscriberEntry(uint_half_t subscriber_id) : RealTimeSubscriberEntry(subscriber_id, 100ms) {}
@@ -55,11 +60,26 @@ struct RealTimePublisherEntry {
   alignas(std::hardware_destructive_interference_size) uint_half_t next_local_message_id = 0;
   const uint_half_t id = std::numeric_limits<uint_half_t>::max();
 
+  /// running message id of this publisher. Each publisher writes its own cache line only.
+  alignas(std::hardware_destructive_interference_size) std::atomic<uint_t> next_message_id =
+      std::numeric_limits<uint_t>::max();
+  /// global message index in message_buffer of the latest message published by this publisher
+  std::atomic<uint_t> latest_published_idx = std::numeric_limits<uint_t>::max();
+  /// publish timestamp of latest_published_idx, used to merge messages of multiple publishers (max_publishers > 1 only)
+  std::atomic<std::int64_t> latest_published_timestamp = -1;
+  /// shares the cache line of next_message_id: subscribers detect a publisher shutdown on the load they do anyway
+  PublisherLifecycle lifecycle;
+
   RealTimePublisherEntry() = default;
   explicit RealTimePublisherEntry(uint_half_t publisher_id) : RealTimePublisherEntry(publisher_id, 100ms) {}
   RealTimePublisherEntry(uint_half_t publisher_id, std::chrono::milliseconds heartbeat_interval)
       : id(publisher_id),
         process_data{.pid = static_cast<std::uint64_t>(getpid()), .creation_timestamp = utils::timestamp()} {}
+  /// re-initialize an entry of a former publisher: the message id keeps on running so subscribers see a change
+  RealTimePublisherEntry(uint_half_t publisher_id, uint_t last_message_id)
+      : RealTimePublisherEntry(publisher_id, 100ms) {
+    next_message_id.store(last_message_id, std::memory_order_relaxed);
+  }
 
   [[nodiscard]] bool is_available() const {
     return (id == 0 && process_data.pid == 0 && process_data.creation_timestamp == -1) || !is_alive();
@@ -70,12 +90,12 @@ struct RealTimePublisherEntry {
 struct RealTimeInstanceData {
   explicit RealTimeInstanceData(const Options<Mode::RealTime>& options) : options(options) {}
 
-  /// running message id
-  alignas(std::hardware_destructive_interference_size) std::atomic<uint_t> next_message_id =
-      std::numeric_limits<uint_t>::max();
-  /// global message index in message_buffer
-  alignas(std::hardware_destructive_interference_size) std::atomic<uint_t> latest_published_idx =
-      std::numeric_limits<uint_t>::max();
+  // running message ids and latest published indices are tracked per publisher (RealTimePublisherEntry)
+
+  /// futex word subscribers park on once they exceeded the spin/yield budget of their WaitStrategy
+  alignas(std::hardware_destructive_interference_size) std::atomic<std::uint32_t> notification_futex = 0;
+  /// number of parked subscribers: publishers only issue a FUTEX_WAKE if this is not 0
+  std::atomic<std::uint32_t> num_waiting_subscribers = 0;
   /// initialization state to avoid concurrent initializations
   alignas(std::hardware_destructive_interference_size) std::atomic<InitializationState> initialization_state =
       InitializationState::uninitialized;
@@ -98,6 +118,9 @@ struct RealTimeInstanceData {
  * | PerSubscriberHeader 0                                   |
  * | ...                                                     |
  * | PerSubscriberHeader m                                   |
+ * | Free-Slot Bitmap 0                                      |
+ * | ...                                                     |
+ * | Free-Slot Bitmap n                                      |
  * | Message Buffer 0                                        |
  * | ...                                                     |
  * | Message Buffer n * numeric::ceil_to_power_of_two(m + 2) |
@@ -109,19 +132,45 @@ class RealTimeMessageBuffer {
   typedef std::remove_cvref_t<T_p> value_type;
 
  public:
+  /// maximum number of messages that can be acquired by all subscribers at the same time
+  static uint_t max_total_acquires(const Options<Mode::RealTime>& options) {
+    const uint_t max_acquires = options.max_subscribers * options.max_concurrent_acquires;
+    if (options.max_total_acquires == 0) {
+      return max_acquires;
+    }
+    return std::min<uint_t>(options.max_total_acquires, max_acquires);
+  }
+
   static uint_half_t per_publisher_pool_size(const Options<Mode::RealTime>& options) {
-    assert(options.max_subscribers <= std::numeric_limits<uint_half_t>::max() - 2);
+    assert(max_total_acquires(options) <= std::numeric_limits<uint_half_t>::max() - 3);
     // rounded to power of two to allow fast wrap-around of index overflows. This is necessary because we track a local
     // message id from which we need to access a T_p in the publishers pool.
-    return numeric::ceil_to_power_of_two((options.max_subscribers * options.max_concurrent_acquires) + 2);
+    // + 3: the latest published message held by the publisher, an outstanding Loan and the message that is currently
+    //  written by publish(args...)
+    return numeric::ceil_to_power_of_two(max_total_acquires(options) + 3);
   }
 
-  static uint_t required_size_bytes(const Options<Mode::RealTime>& options) {
+  /// number of 64 bit words of one publishers free-slot bitmap, padded to full cache lines
+  static uint_t free_slot_bitmap_words(const Options<Mode::RealTime>& options) {
+    constexpr uint_t words_per_cache_line = std::hardware_destructive_interference_size / sizeof(std::uint64_t);
+    const uint_t num_words = (per_publisher_pool_size(options) + 63) / 64;
+    return (num_words + words_per_cache_line - 1) / words_per_cache_line * words_per_cache_line;
+  }
+
+  static uint_t free_slot_bitmaps_offset(const Options<Mode::RealTime>& options) {
     return sizeof(RealTimeInstanceData)                                 // one common header
            + (sizeof(RealTimePublisherEntry) * options.max_publishers)  // each publisher needs a RealTimePublisherEntry
-           + (sizeof(RealTimeSubscriberEntry) *
-              options.max_subscribers)  // each subscriber needs a RealTimeSubscriberEntry
-           + (sizeof(T_p) * per_publisher_pool_size(options) * options.max_publishers);  // total number of T_p
+           + (sizeof(RealTimeSubscriberEntry) * options.max_subscribers);  // each subscriber needs a RealTimeSubscriberEntry
+  }
+
+  static uint_t message_buffer_offset(const Options<Mode::RealTime>& options) {
+    return free_slot_bitmaps_offset(options) +
+           (sizeof(std::uint64_t) * free_slot_bitmap_words(options) * options.max_publishers);  // one per publisher
+  }
+
+  static uint_t required_size_bytes(const Options<Mode::RealTime>& options) {
+    return message_buffer_offset(options) +
+           (sizeof(T_p) * per_publisher_pool_size(options) * options.max_publishers);  // total number of T_p
   }
 
   static uint_t message_buffer_size(const Options<Mode::RealTime>& options) {
@@ -170,12 +219,23 @@ class RealTimeMessageBuffer {
       std::construct_at(std::addressof(ps_header));
     }
 
-    std::span<T_p> buffer(reinterpret_cast<T_p*>(addr + sizeof(RealTimeInstanceData) +
-                                                 (sizeof(RealTimePublisherEntry) * options.max_publishers) +
-                                                 (sizeof(RealTimeSubscriberEntry) * options.max_subscribers)),
-                          capacity);
-    for (auto& elem : buffer) {
-      std::construct_at(std::addressof(elem), std::forward<T_Args>(args)...);
+    std::span<std::atomic<std::uint64_t>> free_slot_bitmaps(
+        reinterpret_cast<std::atomic<std::uint64_t>*>(addr + free_slot_bitmaps_offset(options)),
+        free_slot_bitmap_words(options) * options.max_publishers);
+    for (auto& word : free_slot_bitmaps) {
+      std::construct_at(std::addressof(word), 0);
+    }
+
+    std::span<T_p> buffer(reinterpret_cast<T_p*>(addr + message_buffer_offset(options)), capacity);
+    const uint_half_t pool_size = per_publisher_pool_size(options);
+    for (uint_t idx = 0; idx < buffer.size(); ++idx) {
+      std::construct_at(std::addressof(buffer[idx]), std::forward<T_Args>(args)...);
+      // all slots are free initially
+      const uint_t local_idx = idx % pool_size;
+      auto& word = free_slot_bitmaps[((idx / pool_size) * free_slot_bitmap_words(options)) + (local_idx / 64)];
+      const std::uint64_t mask = std::uint64_t(1) << (local_idx % 64);
+      word.fetch_or(mask, std::memory_order_relaxed);
+      buffer[idx].track_free_slot(&word, mask);
     }
 
     expected_initialization_value = InitializationState::in_initialization;
@@ -184,7 +244,7 @@ class RealTimeMessageBuffer {
       // TODO: something is off with initialization
       return std::unexpected(std::error_code(1, std::system_category()));
     }
-    return RealTimeMessageBuffer(header, per_publisher_headers, per_subscriber_headers, buffer);
+    return RealTimeMessageBuffer(header, per_publisher_headers, per_subscriber_headers, free_slot_bitmaps, buffer);
   }
 
   static std::expected<RealTimeMessageBuffer, std::error_code> read_at(std::uintptr_t addr,
@@ -218,12 +278,12 @@ class RealTimeMessageBuffer {
         reinterpret_cast<RealTimeSubscriberEntry*>(addr + sizeof(RealTimeInstanceData) +
                                                    (sizeof(RealTimePublisherEntry) * header->options.max_publishers)),
         header->options.max_subscribers);
-    std::span<T_p> buffer(reinterpret_cast<T_p*>(addr + sizeof(RealTimeInstanceData) +
-                                                 (sizeof(RealTimePublisherEntry) * header->options.max_publishers) +
-                                                 (sizeof(RealTimeSubscriberEntry) * header->options.max_subscribers)),
-                          capacity);
+    std::span<std::atomic<std::uint64_t>> free_slot_bitmaps(
+        reinterpret_cast<std::atomic<std::uint64_t>*>(addr + free_slot_bitmaps_offset(header->options)),
+        free_slot_bitmap_words(header->options) * header->options.max_publishers);
+    std::span<T_p> buffer(reinterpret_cast<T_p*>(addr + message_buffer_offset(header->options)), capacity);
 
-    return RealTimeMessageBuffer(header, pp_headers, ps_headers, buffer);
+    return RealTimeMessageBuffer(header, pp_headers, ps_headers, free_slot_bitmaps, buffer);
   }
 
  public:
@@ -249,16 +309,33 @@ class RealTimeMessageBuffer {
   RealTimePublisherEntry* per_publisher_header(uint_half_t publisher_idx) {
     return std::addressof(_publisher_entries[publisher_idx]);
   }
+  [[nodiscard]] uint_half_t num_publisher_entries() const { return static_cast<uint_half_t>(_publisher_entries.size()); }
   RealTimeSubscriberEntry* per_subscriber_header(uint_half_t subscriber_idx) {
     return std::addressof(_subscriber_entries[subscriber_idx]);
   }
+  /// bitmap of the slots of a publishers pool that are not referenced by anyone (bit set: free)
+  std::span<std::atomic<std::uint64_t>> free_slot_bitmap(uint_half_t publisher_idx) {
+    const uint_t num_words = free_slot_bitmap_words(_common_header->options);
+    return _free_slot_bitmaps.subspan(publisher_idx * num_words, num_words);
+  }
+
+  /// number of messages acquired by all subscribers of the topic
+  [[nodiscard]] int_t num_acquired_messages() const {
+    int_t num_acquired = 0;
+    for (const auto& subscriber_entry : _subscriber_entries) {
+      num_acquired += subscriber_entry.acquired_messages.load(std::memory_order_seq_cst);
+    }
+    return num_acquired;
+  }
 
  private:
   RealTimeMessageBuffer(RealTimeInstanceData* header, std::span<RealTimePublisherEntry> pp_headers,
-                        std::span<RealTimeSubscriberEntry> ps_headers, std::span<value_type> queue_items)
+                        std::span<RealTimeSubscriberEntry> ps_headers,
+                        std::span<std::atomic<std::uint64_t>> free_slot_bitmaps, std::span<value_type> queue_items)
       : _common_header(header),
         _publisher_entries(pp_headers),
         _subscriber_entries(ps_headers),
+        _free_slot_bitmaps(free_slot_bitmaps),
         _buffer(queue_items),
         _h_wrap_around_value(RealTimeMessageBuffer::per_publisher_pool_size(header->options) - 1) {}
 
@@ -266,6 +343,7 @@ class RealTimeMessageBuffer {
   RealTimeInstanceData* _common_header;
   std::span<RealTimePublisherEntry> _publisher_entries;
   std::span<RealTimeSubscriberEntry> _subscriber_entries;
+  std::span<std::atomic<std::uint64_t>> _free_slot_bitmaps;
   std::span<value_type> _buffer;
   /// internally used for wrap-around of local message id to index: per_publisher_pool_size(header->num_subscribers) - 1
   // TODO: make const
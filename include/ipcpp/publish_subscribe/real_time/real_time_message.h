@@ -12,6 +12,8 @@
 #include <ipcpp/utils/mutex.h>
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <numeric>
 #include <optional>
 
@@ -58,6 +60,7 @@ class Message {
     void reset() {
       _message->_opt_value.reset();
       _message->_message_id = Message<T_p>::invalid_id_v;
+      _message->_m_mark_free();
     }
 
     T_p* operator->() { return &(_message->_opt_value.value()); }
@@ -66,7 +69,7 @@ class Message {
     T_p& operator*() { return _message->_opt_value.value(); }
     const T_p& operator*() const { return _message->_opt_value.value(); }
 
-    explicit operator bool() const { return _message->_opt_value.has_value(); }
+    explicit operator bool() const { return _message != nullptr && _message->_opt_value.has_value(); }
 
    private:
     Message<T_p>* _message = nullptr;
@@ -118,9 +121,30 @@ class Message {
 
   [[nodiscard]] uint_t id() const { return _message_id; }
 
+  /**
+   * @brief Track this message in a bit of its publishers free-slot bitmap: the bit is set whenever the last reference
+   *  is released. The word is stored relative to `this` so that it is valid in all processes mapping the buffer.
+   */
+  void track_free_slot(std::atomic<std::uint64_t>* word, std::uint64_t mask) {
+    _free_slot_word_offset = reinterpret_cast<std::byte*>(word) - reinterpret_cast<std::byte*>(this);
+    _free_slot_mask = mask;
+  }
+
+ private:
+  void _m_mark_free() {
+    if (_free_slot_mask == 0) {
+      return;
+    }
+    auto* word =
+        reinterpret_cast<std::atomic<std::uint64_t>*>(reinterpret_cast<std::byte*>(this) + _free_slot_word_offset);
+    word->fetch_or(_free_slot_mask, std::memory_order_release);
+  }
+
  private:
   std::optional<T_p> _opt_value = std::nullopt;
   alignas(std::hardware_destructive_interference_size) uint_t _message_id = invalid_id_v;
+  std::ptrdiff_t _free_slot_word_offset = 0;
+  std::uint64_t _free_slot_mask = 0;
   alignas(std::hardware_destructive_interference_size) std::atomic<uint_t> _active_reference_counter = 0;
 };
 
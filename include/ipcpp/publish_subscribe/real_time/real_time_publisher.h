@@ -8,15 +8,20 @@
 #pragma once
 
 #include <ipcpp/publish_subscribe/options.h>
+#include <ipcpp/publish_subscribe/rate_limiter.h>
 #include <ipcpp/publish_subscribe/real_time/real_time_memory_layout.h>
 #include <ipcpp/publish_subscribe/real_time/real_time_message.h>
 #include <ipcpp/topic.h>
 #include <ipcpp/types.h>
+#include <ipcpp/utils/mutex.h>
 #include <ipcpp/utils/numeric.h>
 #include <ipcpp/utils/utils.h>
 
+#include <atomic>
+#include <bit>
 #include <expected>
 #include <filesystem>
+#include <optional>
 #include <string>
 
 namespace ipcpp::ps {
@@ -52,7 +57,8 @@ class RealTimePublisher {
  public:
   static std::expected<RealTimePublisher, std::error_code> create(const std::string& topic_id,
                                                                   Options<Mode::RealTime> options = {}) {
-    auto e_topic = get_shm_entry(topic_id, RealTimeMessageBuffer<message_type>::required_size_bytes(options));
+    auto e_topic = get_shm_entry(topic_id, RealTimeMessageBuffer<message_type>::required_size_bytes(options),
+                                 options.mapping_options);
     if (!e_topic) {
       return std::unexpected(e_topic.error());
     }
@@ -83,19 +89,60 @@ class RealTimePublisher {
   }
 
  public:
+  /**
+   * @brief Writable handle to a message slot of the publishers pool that is not yet visible to subscribers. Returned by
+   *  RealTimePublisher::loan and consumed by RealTimePublisher::publish(Loan&&) or RealTimePublisher::discard.
+   *  A Loan that is destroyed without being published is discarded.
+   */
+  class Loan {
+    friend class RealTimePublisher;
+
+   public:
+    Loan(const Loan&) = delete;
+    Loan& operator=(const Loan&) = delete;
+    Loan(Loan&& other) noexcept : _access(std::move(other._access)) {
+      std::swap(_global_message_idx, other._global_message_idx);
+    }
+    Loan& operator=(Loan&& other) noexcept {
+      if (this != &other) {
+        _access = std::move(other._access);
+        _global_message_idx = other._global_message_idx;
+        other._global_message_idx = message_type::invalid_id_v;
+      }
+      return *this;
+    }
+
+    T_p* operator->() { return _access.operator->(); }
+    const T_p* operator->() const { return _access.operator->(); }
+
+    T_p& operator*() { return *_access; }
+    const T_p& operator*() const { return *_access; }
+
+    explicit operator bool() const { return _global_message_idx != message_type::invalid_id_v; }
+
+   private:
+    Loan(access_type&& access, uint_t global_message_idx)
+        : _access(std::move(access)), _global_message_idx(global_message_idx) {}
+
+    access_type _access;
+    uint_t _global_message_idx = message_type::invalid_id_v;
+  };
+
+ public:
+  /**
+   * @brief Construct a message in the next free slot and publish it.
+   *
+   *  With Options::publish_interval set, subscribers are notified at most once per interval: a message published within
+   *  the interval is kept pending (coalesced) and superseded by the next one. The pending message is published by the
+   *  first publish() after the interval elapsed, by flush_if_due() or by flush().
+   */
   template <typename... T_Args>
+    requires std::is_constructible_v<T_p, T_Args...>
   std::error_code publish(T_Args&&... args) {
-    message_type* message = nullptr;
-    uint_half_t idx;
-    while (true) {
-      uint_half_t local_message_id = _pp_header->next_local_message_id++;
-      idx = local_message_id & _wrap_around_value;
-      message = &_assigned_area[idx];
-      if (message->id() == message->invalid_id_v) {
-        break;
-      }
+    if (_rate_limiter.enabled()) [[unlikely]] {
+      return publish(loan(std::forward<T_Args>(args)...));
     }
-    auto global_message_idx = _publisher_buffer_offset + idx;
+    auto [message, global_message_idx] = _m_next_free_message();
     message->emplace(global_message_idx, std::forward<T_Args>(args)...);
     logging::debug("RealTimePublisher<'{}'>::publish: emplaced message #{} (publisher: {}, global_index: {})",
                    _topic->id(), _publisher_id, _publisher_id, global_message_idx);
@@ -105,6 +152,89 @@ class RealTimePublisher {
     return {};
   }
 
+  /**
+   * @brief Construct a T_p from args directly in the next free slot of the publishers shared memory pool and hand it out
+   *  for writing. Nothing is visible to subscribers until the Loan is published.
+   *
+   * @attention Only one Loan per publisher may be outstanding at a time: the pool reserves one slot for it, so
+   *  publish(args...) may still be called meanwhile. A pending (coalesced, see Options::publish_interval) message
+   *  counts as that Loan: its slot is reused and the pending message is superseded.
+   */
+  template <typename... T_Args>
+    requires std::is_constructible_v<T_p, T_Args...>
+  Loan loan(T_Args&&... args) {
+    if (_pending) {
+      Loan loan = std::move(_pending.value());
+      _pending.reset();
+      // the slot was never visible to subscribers: we hold its only reference
+      _assigned_area[loan._global_message_idx - _publisher_buffer_offset].emplace(loan._global_message_idx,
+                                                                                  std::forward<T_Args>(args)...);
+      return loan;
+    }
+    auto [message, global_message_idx] = _m_next_free_message();
+    message->emplace(global_message_idx, std::forward<T_Args>(args)...);
+    logging::debug("RealTimePublisher<'{}'>::loan: loaned message (publisher: {}, global_index: {})", _topic->id(),
+                   _publisher_id, global_message_idx);
+    return Loan(message->acquire_unsafe(), global_message_idx);
+  }
+
+  /**
+   * @brief Publish a message previously written through a Loan without copying it.
+   */
+  std::error_code publish(Loan&& loan) {
+    assert(loan && loan._global_message_idx >= _publisher_buffer_offset &&
+           loan._global_message_idx < _publisher_buffer_offset + _assigned_area.size());
+    if (!_rate_limiter.try_acquire()) {
+      _pending.emplace(std::move(loan));
+      return {};
+    }
+    _m_publish_loan(std::move(loan));
+
+    return {};
+  }
+
+  /**
+   * @brief Publish the pending (coalesced) message if the current publish interval elapsed.
+   * @return true if a message was published
+   */
+  bool flush_if_due() {
+    if (!_pending || !_rate_limiter.try_acquire()) {
+      return false;
+    }
+    _m_publish_pending();
+    return true;
+  }
+
+  /**
+   * @brief Publish the pending (coalesced) message immediately, regardless of the publish interval. Call before
+   *  destroying a rate limited publisher, pending messages are discarded otherwise.
+   * @return true if a message was published
+   */
+  bool flush() {
+    if (!_pending) {
+      return false;
+    }
+    _rate_limiter.reset();
+    _m_publish_pending();
+    return true;
+  }
+
+  /// true if a message was published within the current interval and is not yet visible to subscribers
+  [[nodiscard]] bool has_pending() const { return _pending.has_value(); }
+
+  /**
+   * @brief Return a loaned slot to the pool without publishing it.
+   */
+  void discard(Loan&& loan) {
+    loan._access.release();
+    loan._global_message_idx = message_type::invalid_id_v;
+  }
+
+  /**
+   * @brief Number of messages currently pinned by subscribers (all publishers of the topic).
+   */
+  [[nodiscard]] int_t num_acquired_messages() const { return _message_buffer.num_acquired_messages(); }
+
  private:
   RealTimePublisher(std::shared_ptr<ShmRegistryEntry>&& topic, const Options<Mode::RealTime>& options,
                     RealTimeMessageBuffer<message_type>&& buffer, uint_half_t publisher_id, uint_half_t entry_idx,
@@ -115,19 +245,91 @@ class RealTimePublisher {
         _publisher_id(publisher_id),
         _publisher_buffer_offset(entry_idx * RealTimeMessageBuffer<message_type>::per_publisher_pool_size(options)),
         _entry_idx(entry_idx),
-        _entry_lock(std::move(lock)){
+        _entry_lock(std::move(lock)),
+        _rate_limiter(options.publish_interval) {
     _assigned_area =
         std::span<message_type>(&_message_buffer[_message_buffer.get_index(_entry_idx, 0)],
                                 _message_buffer.per_publisher_pool_size(_message_buffer.common_header()->options));
     _wrap_around_value = _assigned_area.size() - 1;
     _pp_header = _message_buffer.per_publisher_header(_entry_idx);
-    std::construct_at(_pp_header, _entry_idx);
+    _num_free_slot_words = static_cast<uint_half_t>((_assigned_area.size() + 63) / 64);
+    _free_slots = _message_buffer.free_slot_bitmap(_entry_idx).first(_num_free_slot_words);
+    const std::uint64_t generation =
+        PublisherLifecycle::generation(_pp_header->lifecycle.state.load(std::memory_order_acquire)) + 1;
+    std::construct_at(_pp_header, _entry_idx, _pp_header->next_message_id.load(std::memory_order_acquire));
+    _lifecycle = internal::PublisherLifecycleGuard(&_pp_header->lifecycle,
+                                                   &_message_buffer.common_header()->notification_futex, generation);
+    _track_publish_timestamps = _message_buffer.common_header()->options.max_publishers > 1;
   }
 
  private:
+  /**
+   * @brief Take the next slot of the assigned area that is neither referenced by subscribers nor loaned from the free-slot
+   *  bitmap. Slots are taken in turns starting behind the previously taken one so that released slots are not reused
+   *  immediately.
+   *
+   *  One load per bitmap word per attempt. The attempts are not bounded: if all slots are pinned (subscribers racing
+   *  for the last acquire of max_total_acquires, or more Loans outstanding than reserved for) it spins until a slot is
+   *  released.
+   *
+   * @return the slot and its global index in the message buffer
+   */
+  inline std::pair<message_type*, uint_t> _m_next_free_message() {
+    while (true) {
+      const uint_half_t start = _pp_header->next_local_message_id & _wrap_around_value;
+      if (auto [word, bit] = _m_find_free_slot(start); word != nullptr) [[likely]] {
+        // only this publisher clears bits, subscribers only set them: the bit is still set
+        word->fetch_and(~(std::uint64_t(1) << bit), std::memory_order_acq_rel);
+        const auto idx = static_cast<uint_half_t>(((word - _free_slots.data()) * 64) + bit);
+        _pp_header->next_local_message_id = idx + 1;
+        return {&_assigned_area[idx], _publisher_buffer_offset + idx};
+      }
+      utils::cpu_relax();
+    }
+  }
+
+  /**
+   * @brief Find the first set bit of the free-slot bitmap at or behind start (wrapping around).
+   * @return the word and bit index or {nullptr, 0} if no slot is free
+   */
+  inline std::pair<std::atomic<std::uint64_t>*, int> _m_find_free_slot(const uint_half_t start) {
+    uint_half_t word_idx = start / 64;
+    std::uint64_t bits = _free_slots[word_idx].load(std::memory_order_acquire) & (~std::uint64_t(0) << (start % 64));
+    // the first word is visited twice: masked at first, completely after wrapping around
+    for (uint_half_t i = 0; i <= _num_free_slot_words; ++i) {
+      if (bits != 0) {
+        return {&_free_slots[word_idx], std::countr_zero(bits)};
+      }
+      word_idx = (word_idx + 1 == _num_free_slot_words) ? 0 : word_idx + 1;
+      bits = _free_slots[word_idx].load(std::memory_order_acquire);
+    }
+    return {nullptr, 0};
+  }
+
+  void _m_publish_loan(Loan&& loan) {
+    _m_notify_subscribers(loan._global_message_idx);
+    _prev_published_message = std::move(loan._access);
+    loan._global_message_idx = message_type::invalid_id_v;
+  }
+
+  void _m_publish_pending() {
+    Loan loan = std::move(_pending.value());
+    _pending.reset();
+    _m_publish_loan(std::move(loan));
+  }
+
   inline void _m_notify_subscribers(uint_t global_index) {
-    _message_buffer.common_header()->latest_published_idx.store(global_index, std::memory_order_release);
-    auto id = _message_buffer.common_header()->next_message_id.fetch_add(1, std::memory_order_release);
+    RealTimeInstanceData* header = _message_buffer.common_header();
+    _pp_header->latest_published_idx.store(global_index, std::memory_order_release);
+    if (_track_publish_timestamps) {
+      _pp_header->latest_published_timestamp.store(utils::timestamp(), std::memory_order_release);
+    }
+    // seq_cst pairs with SpinThenPark::park: either the subscriber sees the new id or we see the subscriber
+    auto id = _pp_header->next_message_id.fetch_add(1, std::memory_order_seq_cst);
+    if (header->num_waiting_subscribers.load(std::memory_order_seq_cst) > 0) [[unlikely]] {
+      header->notification_futex.fetch_add(1, std::memory_order_release);
+      futex_wake(header->notification_futex);
+    }
     logging::debug("RealTimePublisher<'{}'>::publish: notified subscribers about published message #{}, at {}",
                    _topic->id(), id, global_index);
   }
@@ -141,6 +343,9 @@ class RealTimePublisher {
   std::span<message_type> _assigned_area;
   /// this publishers header
   RealTimePublisherEntry* _pp_header = nullptr;
+  /// free-slot bitmap of the assigned area (bit set: slot is free), maintained by rt::Message::Access::release
+  std::span<std::atomic<std::uint64_t>> _free_slots;
+  uint_half_t _num_free_slot_words = 0;
   /// options
   ps::Options<Mode::RealTime> _options;
   /// id
@@ -149,11 +354,19 @@ class RealTimePublisher {
   access_type _prev_published_message;
   /// wrap around value for fast modulo
   uint_half_t _wrap_around_value;
+  /// publish timestamps are only needed by subscribers to merge messages of multiple publishers
+  bool _track_publish_timestamps = false;
   uint_t _publisher_buffer_offset;
   /// publisher entry idx in shm
   uint_half_t _entry_idx;
   /// lock for the entry idx
   utils::InterProcessLock _entry_lock;
+  /// limits subscriber notifications to one per Options::publish_interval
+  internal::NotificationRateLimiter _rate_limiter;
+  /// latest message published within the current interval, not yet visible to subscribers
+  std::optional<Loan> _pending;
+  /// marks this publisher alive in its entry, marks it down and wakes parked subscribers on destruction
+  internal::PublisherLifecycleGuard _lifecycle;
 };
 
 }  // namespace ipcpp::ps
\ No newline at end of file
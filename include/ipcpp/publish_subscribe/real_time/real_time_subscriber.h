@@ -7,14 +7,22 @@
 
 #pragma once
 
+#include <ipcpp/event/wait_policy.h>
+#include <ipcpp/publish_subscribe/options.h>
 #include <ipcpp/publish_subscribe/real_time/error_codes.h>
 #include <ipcpp/publish_subscribe/real_time/real_time_memory_layout.h>
 #include <ipcpp/publish_subscribe/real_time/real_time_message.h>
 #include <ipcpp/topic.h>
 #include <ipcpp/types.h>
+#include <ipcpp/utils/mutex.h>
+#include <ipcpp/utils/utils.h>
 
+#include <algorithm>
 #include <expected>
 #include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace ipcpp::ps {
 
@@ -58,23 +66,23 @@ class RealTimeSubscriber {
     }
 
     void cleanup() {
-      if (_acquire_counter == nullptr) [[unlikely]] /*only true if move constructor was used*/ {
+      if (_acquire_counter == nullptr) [[unlikely]] /*moved from or already cleaned up*/ {
         return;
       }
       _access.release();
-      _acquire_counter->fetch_add(1, std::memory_order_release);
+      // the counter lives in shared memory: it must be decremented exactly once per counted acquire
+      std::exchange(_acquire_counter, nullptr)->fetch_sub(1, std::memory_order_release);
     }
 
     MessageWrapper(const MessageWrapper&) = delete;
-    MessageWrapper(MessageWrapper&& other) : _access(std::move(other._access)) {
-      std::swap(_acquire_counter, other._acquire_counter);
-    }
+    MessageWrapper(MessageWrapper&& other) noexcept
+        : _acquire_counter(std::exchange(other._acquire_counter, nullptr)), _access(std::move(other._access)) {}
     MessageWrapper& operator=(const MessageWrapper&) = delete;
-    MessageWrapper& operator=(MessageWrapper&& other) {
+    MessageWrapper& operator=(MessageWrapper&& other) noexcept {
       if (this != &other) {
         cleanup();
         _access = std::move(other._access);
-        std::swap(_acquire_counter, other._acquire_counter);
+        _acquire_counter = std::exchange(other._acquire_counter, nullptr);
       }
       return *this;
     }
@@ -94,7 +102,8 @@ class RealTimeSubscriber {
   };
 
  public:
-  static std::expected<RealTimeSubscriber, std::error_code> create(const std::string& topic_id) {
+  static std::expected<RealTimeSubscriber, std::error_code> create(const std::string& topic_id,
+                                                                   SubscriberOptions<Mode::RealTime> options = {}) {
     auto e_topic = get_shm_entry(topic_id);
     if (!e_topic) {
       return std::unexpected(e_topic.error());
@@ -116,9 +125,16 @@ class RealTimeSubscriber {
       return std::unexpected(e.error());
     } else {
       auto [_entry_idx, _entry_lock] = std::move(e.value());
-      auto next_message_id = buffer.common_header()->next_message_id.load(std::memory_order_acquire);
-      RealTimeSubscriber self(std::move(e_topic.value()), std::move(e_buffer.value()), subscriber_id,
-                              max_concurrent_acquires, _entry_idx, std::move(_entry_lock), next_message_id);
+      std::vector<uint_t> next_message_ids(buffer.num_publisher_entries());
+      for (uint_half_t idx = 0; idx < next_message_ids.size(); ++idx) {
+        next_message_ids[idx] = buffer.per_publisher_header(idx)->next_message_id.load(std::memory_order_acquire);
+      }
+      RealTimeSubscriber self(std::move(e_topic.value()), std::move(e_buffer.value()), options, subscriber_id,
+                              max_concurrent_acquires, _entry_idx, std::move(_entry_lock),
+                              std::move(next_message_ids));
+      if (options.subscription_mode == RealTimeSubscriptionMode::Latched) {
+        self._m_acquire_latched_message();
+      }
 
       return self;
     }
@@ -132,76 +148,290 @@ class RealTimeSubscriber {
    */
 
  public:
+  /**
+   * @brief Acquire the latest message that was not fetched yet.
+   *
+   * @return the message or
+   *  - std::errc::no_message_available if no new message was published since the last fetch
+   *  - std::errc::owner_dead if additionally no publisher is alive anymore
+   *  - std::errc::invalid_seek if the acquire limits are exceeded
+   */
   std::expected<MessageWrapper, std::error_code> fetch_message() {
-    if (auto message_id = _message_buffer.common_header()->next_message_id.load(std::memory_order_acquire);
-        message_id != _next_message_id) {
-      uint_t message_idx = _message_buffer.common_header()->latest_published_idx.load(std::memory_order_acquire);
+    if (_latched_message) [[unlikely]] {
+      // already counted by _m_acquire_latched_message
+      MessageWrapper message = std::move(_latched_message.value());
+      _latched_message.reset();
+      return message;
+    }
+    if (auto publisher_idx = _m_select_publisher(); publisher_idx.has_value()) {
+      uint_t message_idx = _message_buffer.per_publisher_header(publisher_idx.value())
+                               ->latest_published_idx.load(std::memory_order_acquire);
+      if (message_idx >= _message_buffer.size()) [[unlikely]] /*publisher entry was just re-initialized*/ {
+        return std::unexpected(std::make_error_code(std::errc::no_message_available));
+      }
+      // checked before marking the message as read: a rejected fetch leaves it available for the next one
+      if (!_m_count_acquire()) {
+        return std::unexpected(std::make_error_code(std::errc::invalid_seek));
+      }
       auto access = _message_buffer[message_idx].acquire_unsafe();
       if (access) {
-        _next_message_id = message_id;
-        auto available_acquires = _available_acquires->fetch_sub(1, std::memory_order_acquire);
-        if (available_acquires <= 0) {
-          _available_acquires->fetch_add(1, std::memory_order_acquire);
-          // TODO: error is that too many messages are already acquired
-          // return std::unexpected(real_time::error::Subscriber::AcquireLimitExceeded);
-          return std::unexpected(std::make_error_code(std::errc::invalid_seek));
-        }
-        return MessageWrapper(_available_acquires.get(), std::move(access));
+        _m_mark_as_read(publisher_idx.value());
+        return MessageWrapper(&_subscriber_entry->acquired_messages, std::move(access));
       }
+      _subscriber_entry->acquired_messages.fetch_sub(1, std::memory_order_release);
+    }
+    // the lifecycle words share the cache lines of the message ids loaded by _m_select_publisher
+    if (!_m_has_alive_publisher()) [[unlikely]] {
+      return std::unexpected(std::make_error_code(std::errc::owner_dead));
     }
     // return std::unexpected(real_time::error::Subscriber::NoMessageAvailable);
     return std::unexpected(std::make_error_code(std::errc::no_message_available));
   }
 
+  /**
+   * @brief Block until a new message is available.
+   * @return the message or the error of fetch_message if acquire limits are exceeded or all publishers are down
+   */
   std::expected<MessageWrapper, std::error_code> await_get_message() {
-    while (true) {
+    for (uint_t iteration = 0;; ++iteration) {
       if (auto e_message = fetch_message(); e_message.has_value()) {
         return std::move(e_message.value());
         //} else if (e_message.error() == real_time::error::Subscriber::AcquireLimitExceeded) {
-      } else if (e_message.error() == std::errc::invalid_seek) {
+      } else if (e_message.error() == std::errc::invalid_seek || e_message.error() == std::errc::owner_dead) {
         return std::unexpected(e_message.error());
       }
+      _m_wait(iteration);
     }
   }
 
+  /// true if fetch_message() would find a message that was not fetched yet
+  [[nodiscard]] bool has_new_data() { return _m_has_new_message(); }
+
+  /// true if at least one publisher of the topic is alive (no syscall: a crash is only detected by parked subscribers)
+  [[nodiscard]] bool has_alive_publisher() { return _m_has_alive_publisher(); }
+
+  /// futex word publishers of this topic bump on publish (used by event::WaitSet)
+  [[nodiscard]] FutexWaitHandle wait_handle() {
+    RealTimeInstanceData* header = _message_buffer.common_header();
+    return {&header->notification_futex, &header->num_waiting_subscribers};
+  }
+
   /**
-   * @brief This method will block forever if the limit of allowed acquires is reached and no acquires are released.
+   * @brief This method will block forever if the limit of allowed acquires is reached and no acquires are released or
+   *  until a new publisher takes over if all publishers are down (see await_get_message).
    * @return
    */
   MessageWrapper await_message() {
-    while (true) {
+    for (uint_t iteration = 0;; ++iteration) {
       if (auto opt = fetch_message(); opt.has_value()) {
         return std::move(opt.value());
       }
+      _m_wait(iteration);
     }
   }
 
  private:
   RealTimeSubscriber(std::shared_ptr<ShmRegistryEntry>&& topic, RealTimeMessageBuffer<message_type>&& buffer,
-                     uint_half_t subscriber_id, uint_half_t max_concurrent_acquires, uint_half_t entry_idx,
-                     std::unique_ptr<utils::InterProcessLock>&& entry_lock, uint_t last_message_id)
+                     const SubscriberOptions<Mode::RealTime>& options, uint_half_t subscriber_id,
+                     uint_half_t max_concurrent_acquires, uint_half_t entry_idx,
+                     std::unique_ptr<utils::InterProcessLock>&& entry_lock, std::vector<uint_t>&& last_message_ids)
       : _topic(std::move(topic)),
         _message_buffer(std::move(buffer)),
+        _options(options),
         _subscriber_id(subscriber_id),
         _entry_idx(entry_idx),
         _entry_lock(std::move(entry_lock)),
-        _available_acquires(std::make_unique<std::atomic<int_t>>(max_concurrent_acquires)),
-        _next_message_id(last_message_id) {}
+        _max_concurrent_acquires(max_concurrent_acquires),
+        _max_total_acquires(RealTimeMessageBuffer<message_type>::max_total_acquires(
+            _message_buffer.common_header()->options)),
+        _next_message_ids(std::move(last_message_ids)),
+        _observed_message_ids(_next_message_ids) {
+    _subscriber_entry = std::construct_at(_message_buffer.per_subscriber_header(_entry_idx), _subscriber_id);
+  }
 
  private:
   inline std::pair<uint_half_t, uint_half_t> _m_split_to_indices(uint_t message_id) {
     return {message_id >> std::numeric_limits<uint_half_t>::digits, static_cast<uint_half_t>(message_id)};
   }
 
+  /**
+   * @brief Select the publisher whose latest message is fetched next according to the PublisherMergePolicy. The
+   *  observed message ids are cached in _observed_message_ids for _m_mark_as_read.
+   *
+   * @return index of the publisher entry or std::nullopt if no publisher published since the last fetch
+   */
+  std::optional<uint_half_t> _m_select_publisher() {
+    const auto num_publishers = static_cast<uint_half_t>(_next_message_ids.size());
+    std::optional<uint_half_t> selected = std::nullopt;
+    std::int64_t selected_timestamp = std::numeric_limits<std::int64_t>::min();
+    for (uint_half_t i = 0; i < num_publishers; ++i) {
+      const uint_half_t idx = (_round_robin_offset + i) % num_publishers;
+      RealTimePublisherEntry* publisher_entry = _message_buffer.per_publisher_header(idx);
+      _observed_message_ids[idx] = publisher_entry->next_message_id.load(std::memory_order_acquire);
+      if (_observed_message_ids[idx] == _next_message_ids[idx]) {
+        continue;
+      }
+      if (_options.merge_policy == PublisherMergePolicy::RoundRobin || num_publishers == 1) {
+        return idx;
+      }
+      if (auto timestamp = publisher_entry->latest_published_timestamp.load(std::memory_order_acquire);
+          !selected.has_value() || timestamp > selected_timestamp) {
+        selected = idx;
+        selected_timestamp = timestamp;
+      }
+    }
+    return selected;
+  }
+
+  /**
+   * @brief Mark the message of the publisher selected by _m_select_publisher as read. For PublisherMergePolicy::Newest,
+   *  all older messages observed during the selection are skipped.
+   */
+  void _m_mark_as_read(const uint_half_t publisher_idx) {
+    if (_options.merge_policy == PublisherMergePolicy::RoundRobin) {
+      _next_message_ids[publisher_idx] = _observed_message_ids[publisher_idx];
+      _round_robin_offset = publisher_idx + 1;
+      return;
+    }
+    std::copy(_observed_message_ids.begin(), _observed_message_ids.end(), _next_message_ids.begin());
+  }
+
+  /**
+   * @brief RealTimeSubscriptionMode::Latched: acquire the latest message published before the subscription (of the
+   *  newest publisher) so that the first fetch_message returns it without waiting for the next publish.
+   *
+   *  The message ids were loaded before the latest indices: a message published in between may be delivered twice
+   *  (latched and by the next fetch_message) but is never skipped.
+   *
+   *  The latched message is counted like a fetched one, no message is latched if the acquire limits are exceeded.
+   */
+  void _m_acquire_latched_message() {
+    std::optional<uint_half_t> selected = std::nullopt;
+    std::int64_t selected_timestamp = std::numeric_limits<std::int64_t>::min();
+    for (uint_half_t idx = 0; idx < _message_buffer.num_publisher_entries(); ++idx) {
+      RealTimePublisherEntry* publisher_entry = _message_buffer.per_publisher_header(idx);
+      if (publisher_entry->latest_published_idx.load(std::memory_order_acquire) >= _message_buffer.size()) {
+        continue;
+      }
+      if (auto timestamp = publisher_entry->latest_published_timestamp.load(std::memory_order_acquire);
+          !selected.has_value() || timestamp > selected_timestamp) {
+        selected = idx;
+        selected_timestamp = timestamp;
+      }
+    }
+    if (!selected.has_value()) {
+      return;
+    }
+    if (!_m_count_acquire()) {
+      logging::debug("RealTimeSubscriber<'{}'>::create: acquire limit exceeded, no message latched", _topic->id());
+      return;
+    }
+    uint_t message_idx =
+        _message_buffer.per_publisher_header(selected.value())->latest_published_idx.load(std::memory_order_acquire);
+    // fails if the publisher released the slot in the meantime: a newer message is available then anyway
+    if (auto o_access = _message_buffer[message_idx].acquire(); o_access.has_value()) {
+      _latched_message.emplace(&_subscriber_entry->acquired_messages, std::move(o_access.value()));
+      logging::debug("RealTimeSubscriber<'{}'>::create: latched message at {}", _topic->id(), message_idx);
+    } else {
+      _subscriber_entry->acquired_messages.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  /**
+   * @brief Count an acquire in the subscribers shm entry so that publishers can see pinned messages.
+   * @return false if the subscribers max_concurrent_acquires or the topic wide max_total_acquires are exceeded
+   */
+  bool _m_count_acquire() {
+    auto& acquired_messages = _subscriber_entry->acquired_messages;
+    if (acquired_messages.fetch_add(1, std::memory_order_seq_cst) >= _max_concurrent_acquires) {
+      acquired_messages.fetch_sub(1, std::memory_order_release);
+      return false;
+    }
+    const auto& options = _message_buffer.common_header()->options;
+    if (_max_total_acquires < options.max_subscribers * options.max_concurrent_acquires &&
+        _message_buffer.num_acquired_messages() > _max_total_acquires) {
+      // seq_cst on both sides: two subscribers racing for the last acquire may both fail, but never both succeed
+      acquired_messages.fetch_sub(1, std::memory_order_release);
+      return false;
+    }
+    return true;
+  }
+
+  [[nodiscard]] bool _m_has_new_message() {
+    if (_latched_message) {
+      return true;
+    }
+    for (uint_half_t idx = 0; idx < _next_message_ids.size(); ++idx) {
+      if (_message_buffer.per_publisher_header(idx)->next_message_id.load(std::memory_order_seq_cst) !=
+          _next_message_ids[idx]) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  [[nodiscard]] bool _m_has_alive_publisher() {
+    for (uint_half_t idx = 0; idx < _next_message_ids.size(); ++idx) {
+      if (PublisherLifecycle::is_alive(
+              _message_buffer.per_publisher_header(idx)->lifecycle.state.load(std::memory_order_acquire))) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Slow path of parked subscribers: mark publishers down whose process does not exist anymore and wake all
+   *  other parked subscribers if any was found.
+   */
+  void _m_check_publisher_processes() {
+    bool marked_down = false;
+    for (uint_half_t idx = 0; idx < _next_message_ids.size(); ++idx) {
+      PublisherLifecycle& lifecycle = _message_buffer.per_publisher_header(idx)->lifecycle;
+      if (PublisherLifecycle::is_alive(lifecycle.state.load(std::memory_order_acquire)) &&
+          !lifecycle.check_process_alive()) {
+        logging::warn("RealTimeSubscriber<'{}'>: publisher entry {} is down (process died)", _topic->id(), idx);
+        marked_down = true;
+      }
+    }
+    if (marked_down) {
+      RealTimeInstanceData* header = _message_buffer.common_header();
+      header->notification_futex.fetch_add(1, std::memory_order_release);
+      futex_wake(header->notification_futex);
+    }
+  }
+
+  /**
+   * @brief Back-off after the iteration-th unsuccessful fetch_message according to the WaitStrategy: spin, yield, park.
+   *  Parked subscribers wake up every liveness_check_interval to detect crashed publishers.
+   */
+  inline void _m_wait(const uint_t iteration) {
+    if (!event::wait_policy::backoff(_options.wait_strategy, iteration, wait_handle(),
+                                     [this]() { return _m_has_new_message(); }, _options.liveness_check_interval)) {
+      // timed out: a crashed publisher never marks itself down
+      _m_check_publisher_processes();
+    }
+  }
+
  private:
   std::shared_ptr<ShmRegistryEntry> _topic = nullptr;
   RealTimeSubscriberEntry* _subscriber_entry = nullptr;
   RealTimeMessageBuffer<message_type> _message_buffer;
+  SubscriberOptions<Mode::RealTime> _options;
   const uint_half_t _subscriber_id;
   const uint_half_t _entry_idx;
   std::unique_ptr<utils::InterProcessLock> _entry_lock;
-  std::unique_ptr<std::atomic<int_t>> _available_acquires;
-  uint_t _next_message_id;
+  const int_t _max_concurrent_acquires;
+  /// topic wide acquire limit, only checked if it is lower than max_subscribers * max_concurrent_acquires
+  const int_t _max_total_acquires;
+  /// last read message id per publisher entry
+  std::vector<uint_t> _next_message_ids;
+  /// message ids per publisher entry seen during the latest _m_select_publisher
+  std::vector<uint_t> _observed_message_ids;
+  /// publisher entry that is checked first by _m_select_publisher (PublisherMergePolicy::RoundRobin)
+  uint_half_t _round_robin_offset = 0;
+  /// message acquired at subscription (RealTimeSubscriptionMode::Latched), handed out by the first fetch_message
+  std::optional<MessageWrapper> _latched_message;
 };
 
 }  // namespace ipcpp::ps
\ No newline at end of file
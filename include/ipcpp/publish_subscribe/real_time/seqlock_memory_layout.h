@@ -0,0 +1,184 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/publish_subscribe/options.h>
+#include <ipcpp/types.h>
+#include <ipcpp/utils/logging.h>
+#include <ipcpp/utils/numeric.h>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <expected>
+#include <new>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+
+namespace ipcpp::ps {
+
+using namespace std::chrono_literals;
+
+namespace rt {
+
+/**
+ * Payloads that are cheaper to copy out of shared memory than to reference count (see SeqlockPublisher).
+ */
+template <typename T_p>
+concept CopyOutPayload = std::is_trivially_copyable_v<T_p> && sizeof(T_p) <= 256;
+
+}  // namespace rt
+
+/**
+ * @brief Ring slot guarded by a sequence lock: the sequence is odd while the publisher writes the value.
+ */
+template <rt::CopyOutPayload T_p>
+struct SeqlockSlot {
+  alignas(std::hardware_destructive_interference_size) std::atomic<uint_t> sequence = 0;
+  /// raw storage: T_p is copied in and out, it is never constructed in shared memory
+  alignas(T_p) std::byte data[sizeof(T_p)];
+};
+
+struct SeqlockInstanceData {
+  /// initialization state to avoid concurrent initializations
+  alignas(std::hardware_destructive_interference_size) std::atomic<InitializationState> initialization_state =
+      InitializationState::uninitialized;
+  uint_t ring_size = 0;
+
+  /// id of the next published message: the latest message lives at slot (next_message_id - 1)
+  alignas(std::hardware_destructive_interference_size) std::atomic<uint_t> next_message_id = 0;
+
+  /// futex word subscribers park on once they exceeded the spin/yield budget of their WaitStrategy
+  alignas(std::hardware_destructive_interference_size) std::atomic<std::uint32_t> notification_futex = 0;
+  /// number of parked subscribers: the publisher only issues a FUTEX_WAKE if this is not 0
+  std::atomic<std::uint32_t> num_waiting_subscribers = 0;
+};
+
+/**
+ * Memory Layout:
+ * |---------------------|
+ * | SeqlockInstanceData |
+ * | SeqlockSlot 0       |
+ * | ...                 |
+ * | SeqlockSlot n       |
+ * |---------------------|
+ */
+template <rt::CopyOutPayload T_p>
+class SeqlockRingBuffer {
+ public:
+  typedef T_p value_type;
+  typedef SeqlockSlot<T_p> slot_type;
+
+  /// a subscriber only tears its copy if the publisher laps the whole ring while it copies
+  static constexpr uint_t default_ring_size = 8;
+
+ public:
+  static uint_t required_size_bytes(uint_t ring_size = default_ring_size) {
+    return sizeof(SeqlockInstanceData) + (sizeof(slot_type) * ring_size);
+  }
+
+  static std::expected<SeqlockRingBuffer, std::error_code> init_at(std::uintptr_t addr, std::size_t size_bytes,
+                                                                   uint_t ring_size = default_ring_size) {
+    logging::debug("SeqlockRingBuffer::init_at()");
+    assert(numeric::is_power_of_two(ring_size));
+    if (size_bytes < required_size_bytes(ring_size)) {
+      logging::warn("SeqlockRingBuffer::init_at: provided size too small");
+      return std::unexpected(std::make_error_code(std::errc::no_buffer_space));
+    }
+    auto* header = reinterpret_cast<SeqlockInstanceData*>(addr);
+    InitializationState expected_initialization_value = InitializationState::uninitialized;
+    if (!header->initialization_state.compare_exchange_strong(
+            expected_initialization_value, InitializationState::in_initialization, std::memory_order_acq_rel)) {
+      // already initialized (e.g. by a former publisher) or in initialization
+      return read_at(addr);
+    }
+    header->ring_size = ring_size;
+    header->next_message_id.store(0, std::memory_order_relaxed);
+    header->notification_futex.store(0, std::memory_order_relaxed);
+    header->num_waiting_subscribers.store(0, std::memory_order_relaxed);
+    std::span<slot_type> slots(reinterpret_cast<slot_type*>(addr + sizeof(SeqlockInstanceData)), ring_size);
+    for (auto& slot : slots) {
+      std::construct_at(std::addressof(slot));
+    }
+    header->initialization_state.store(InitializationState::initialized, std::memory_order_release);
+    return SeqlockRingBuffer(header, slots);
+  }
+
+  static std::expected<SeqlockRingBuffer, std::error_code> read_at(std::uintptr_t addr,
+                                                                   std::chrono::milliseconds timeout = 1000ms) {
+    logging::debug("SeqlockRingBuffer::read_at()");
+    auto* header = reinterpret_cast<SeqlockInstanceData*>(addr);
+
+    {  // wait for SeqlockInstanceData to be initialized or timeout
+      using clock = std::chrono::high_resolution_clock;
+      auto start = clock::now();
+      while (header->initialization_state.load(std::memory_order_acquire) != InitializationState::initialized) {
+        if (std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - start) >= timeout) {
+          logging::warn("SeqlockRingBuffer::read_at: memory not initialized (using SeqlockRingBuffer::init_at)");
+          return std::unexpected(std::make_error_code(std::errc::timed_out));
+        }
+        std::this_thread::sleep_for(1ms);
+      }
+    }
+    std::span<slot_type> slots(reinterpret_cast<slot_type*>(addr + sizeof(SeqlockInstanceData)), header->ring_size);
+    return SeqlockRingBuffer(header, slots);
+  }
+
+ public:
+  /**
+   * @brief Copy value into the slot of message_id. Single writer only.
+   */
+  void write(uint_t message_id, const T_p& value) {
+    slot_type& slot = _slots[message_id & _wrap_around_value];
+    const uint_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(slot.data, std::addressof(value), sizeof(T_p));
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  /**
+   * @brief Copy the value of the slot of message_id out. Readers never write to shared memory.
+   * @return the value or std::nullopt if the publisher wrote the slot concurrently (torn copy)
+   */
+  std::optional<T_p> try_read(uint_t message_id) const {
+    const slot_type& slot = _slots[message_id & _wrap_around_value];
+    const uint_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence & 1) {
+      return std::nullopt;
+    }
+    std::array<std::byte, sizeof(T_p)> bytes;
+    std::memcpy(bytes.data(), slot.data, sizeof(T_p));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+      return std::nullopt;
+    }
+    // T_p does not need to be default constructible
+    return std::bit_cast<T_p>(bytes);
+  }
+
+  SeqlockInstanceData* header() { return _header; }
+  [[nodiscard]] uint_t size() const { return _slots.size(); }
+
+ private:
+  SeqlockRingBuffer(SeqlockInstanceData* header, std::span<slot_type> slots)
+      : _header(header), _slots(slots), _wrap_around_value(slots.size() - 1) {}
+
+ private:
+  SeqlockInstanceData* _header;
+  std::span<slot_type> _slots;
+  uint_t _wrap_around_value;
+};
+
+}  // namespace ipcpp::ps
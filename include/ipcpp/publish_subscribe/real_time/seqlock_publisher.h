@@ -0,0 +1,83 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/publish_subscribe/real_time/seqlock_memory_layout.h>
+#include <ipcpp/topic.h>
+#include <ipcpp/types.h>
+#include <ipcpp/utils/ip_lock.h>
+#include <ipcpp/utils/mutex.h>
+
+#include <expected>
+#include <format>
+#include <memory>
+#include <string>
+
+namespace ipcpp::ps {
+
+/**
+ * @brief RealTime publisher for small trivially copyable payloads: messages are copied into a seqlock'd ring and copied
+ *  out by SeqlockSubscribers. Unlike RealTimePublisher, there is no reference counting: subscribers never write to
+ *  shared cache lines and the publisher never waits for them.
+ *
+ * @attention only one SeqlockPublisher per topic.
+ */
+template <rt::CopyOutPayload T_p>
+class SeqlockPublisher {
+ public:
+  typedef T_p value_type;
+  typedef SeqlockRingBuffer<T_p> buffer_type;
+
+ public:
+  static std::expected<SeqlockPublisher, std::error_code> create(const std::string& topic_id) {
+    auto lock = std::make_unique<utils::InterProcessLock>(std::format("{}_seqlock_publisher", topic_id));
+    if (bool acquired = false; lock->try_lock(acquired).value() != 0 || !acquired) {
+      return std::unexpected(std::make_error_code(std::errc::device_or_resource_busy));
+    }
+    auto e_topic = get_shm_entry(topic_id, buffer_type::required_size_bytes());
+    if (!e_topic) {
+      return std::unexpected(e_topic.error());
+    }
+    auto e_buffer = buffer_type::init_at(e_topic.value()->shm().addr(), e_topic.value()->shm().size());
+    if (!e_buffer) {
+      return std::unexpected(e_buffer.error());
+    }
+    return SeqlockPublisher(std::move(e_topic.value()), std::move(e_buffer.value()), std::move(lock));
+  }
+
+ public:
+  template <typename... T_Args>
+    requires std::is_constructible_v<T_p, T_Args...>
+  std::error_code publish(T_Args&&... args) {
+    SeqlockInstanceData* header = _buffer.header();
+    const uint_t message_id = header->next_message_id.load(std::memory_order_relaxed);
+    _buffer.write(message_id, T_p(std::forward<T_Args>(args)...));
+    // seq_cst pairs with SpinThenPark::park: either the subscriber sees the new id or we see the subscriber
+    header->next_message_id.store(message_id + 1, std::memory_order_seq_cst);
+    if (header->num_waiting_subscribers.load(std::memory_order_seq_cst) > 0) [[unlikely]] {
+      header->notification_futex.fetch_add(1, std::memory_order_release);
+      futex_wake(header->notification_futex);
+    }
+    logging::debug("SeqlockPublisher<'{}'>::publish: published message #{}", _topic->id(), message_id);
+    return {};
+  }
+
+ private:
+  SeqlockPublisher(std::shared_ptr<ShmRegistryEntry>&& topic, buffer_type&& buffer,
+                   std::unique_ptr<utils::InterProcessLock>&& lock)
+      : _topic(std::move(topic)), _buffer(std::move(buffer)), _publisher_lock(std::move(lock)) {}
+
+ private:
+  /// the full shared memory entry to ensure its validity
+  std::shared_ptr<ShmRegistryEntry> _topic = nullptr;
+  buffer_type _buffer;
+  /// ensures a single writer per topic
+  std::unique_ptr<utils::InterProcessLock> _publisher_lock;
+};
+
+}  // namespace ipcpp::ps
@@ -0,0 +1,115 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/event/wait_policy.h>
+#include <ipcpp/publish_subscribe/options.h>
+#include <ipcpp/publish_subscribe/real_time/seqlock_memory_layout.h>
+#include <ipcpp/topic.h>
+#include <ipcpp/types.h>
+#include <ipcpp/utils/mutex.h>
+#include <ipcpp/utils/utils.h>
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace ipcpp::ps {
+
+/**
+ * @brief Subscriber of a SeqlockPublisher: fetches a copy of the latest message. A copy that was torn by a concurrent
+ *  write is retried, readers never write to shared memory (except for parking, see WaitStrategy).
+ */
+template <rt::CopyOutPayload T_p>
+class SeqlockSubscriber {
+ public:
+  typedef T_p value_type;
+  typedef SeqlockRingBuffer<T_p> buffer_type;
+
+ public:
+  static std::expected<SeqlockSubscriber, std::error_code> create(const std::string& topic_id,
+                                                                  SubscriberOptions<Mode::RealTime> options = {}) {
+    auto e_topic = get_shm_entry(topic_id);
+    if (!e_topic) {
+      return std::unexpected(e_topic.error());
+    }
+    auto e_buffer = buffer_type::read_at(e_topic.value()->shm().addr());
+    if (!e_buffer) {
+      return std::unexpected(e_buffer.error());
+    }
+    SeqlockSubscriber self(std::move(e_topic.value()), std::move(e_buffer.value()), options);
+    if (options.subscription_mode == RealTimeSubscriptionMode::Volatile) {
+      self._next_message_id = self._buffer.header()->next_message_id.load(std::memory_order_acquire);
+    }
+    return self;
+  }
+
+ public:
+  /**
+   * @brief Copy the latest message out if it was published since the last fetch.
+   */
+  std::expected<T_p, std::error_code> fetch_message() {
+    while (true) {
+      const uint_t next_message_id = _buffer.header()->next_message_id.load(std::memory_order_acquire);
+      if (next_message_id == _next_message_id) {
+        return std::unexpected(std::make_error_code(std::errc::no_message_available));
+      }
+      if (auto o_value = _buffer.try_read(next_message_id - 1); o_value.has_value()) [[likely]] {
+        _next_message_id = next_message_id;
+        return o_value.value();
+      }
+      // torn read: the publisher overwrote the slot, a newer message is available
+      utils::cpu_relax();
+    }
+  }
+
+  /// true if fetch_message() would find a message that was not fetched yet
+  [[nodiscard]] bool has_new_data() {
+    return _buffer.header()->next_message_id.load(std::memory_order_seq_cst) != _next_message_id;
+  }
+
+  /// futex word the publisher of this topic bumps on publish (used by event::WaitSet)
+  [[nodiscard]] FutexWaitHandle wait_handle() {
+    SeqlockInstanceData* header = _buffer.header();
+    return {&header->notification_futex, &header->num_waiting_subscribers};
+  }
+
+  T_p await_message() {
+    for (uint_t iteration = 0;; ++iteration) {
+      if (auto e_message = fetch_message(); e_message.has_value()) {
+        return e_message.value();
+      }
+      _m_wait(iteration);
+    }
+  }
+
+ private:
+  SeqlockSubscriber(std::shared_ptr<ShmRegistryEntry>&& topic, buffer_type&& buffer,
+                    const SubscriberOptions<Mode::RealTime>& options)
+      : _topic(std::move(topic)), _buffer(std::move(buffer)), _options(options) {}
+
+  /**
+   * @brief Back-off after the iteration-th unsuccessful fetch_message according to the WaitStrategy: spin, yield, park.
+   *  Parking is bounded by liveness_check_interval, so a lost wake up only delays the subscriber.
+   */
+  inline void _m_wait(const uint_t iteration) {
+    event::wait_policy::backoff(_options.wait_strategy, iteration, wait_handle(), [this]() { return has_new_data(); },
+                                _options.liveness_check_interval);
+  }
+
+ private:
+  /// the full shared memory entry to ensure its validity
+  std::shared_ptr<ShmRegistryEntry> _topic = nullptr;
+  buffer_type _buffer;
+  SubscriberOptions<Mode::RealTime> _options;
+  /// next_message_id of the latest fetched message (0 for Latched subscriptions: the latest message is fetched first)
+  uint_t _next_message_id = 0;
+};
+
+}  // namespace ipcpp::ps
@@ -0,0 +1,158 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/utils/numeric.h>
+#include <ipcpp/utils/utils.h>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <new>
+#include <span>
+#include <system_error>
+#include <type_traits>
+
+namespace ipcpp::shm {
+
+/**
+ * @brief Single producer, multi consumer broadcast ring located in (shared) memory.
+ *
+ * Every slot carries a sequence stamp: it is 2 * index + 1 while the producer writes the element with the given index
+ * and 2 * index + 2 once it is written. Consumers only read (they keep their own cursor) and copy elements out, so
+ * they never slow down the producer. A consumer that is lapped by the producer does not read corrupted data: the
+ * stamp tells it that its element was overwritten (std::errc::value_too_large) and its cursor is moved to the oldest
+ * element that is still available.
+ *
+ * Memory Layout:
+ * |-----------|
+ * | _s_header |
+ * | slot 0    |
+ * | ...       |
+ * | slot n    |
+ * |-----------|
+ */
+template <typename T_p>
+  requires std::is_trivially_copyable_v<T_p>
+class broadcast_ring_buffer {
+ public:
+  typedef T_p value_type;
+
+ private:
+  struct _s_header {
+    /// index of the next element written by the producer
+    alignas(std::hardware_destructive_interference_size) std::atomic_uint64_t next_index = 0;
+    /// number of slots (power of 2)
+    alignas(std::hardware_destructive_interference_size) std::uint64_t capacity = 0;
+  };
+
+  struct _s_slot {
+    std::atomic_uint64_t sequence = 0;
+    /// raw storage: T_p is copied in and out, it is never constructed in shared memory
+    alignas(T_p) std::byte data[sizeof(T_p)];
+  };
+
+ public:
+  static std::size_t required_bytes_for(const std::size_t num_elements) {
+    return utils::align_up(sizeof(_s_header)) + num_elements * sizeof(_s_slot);
+  }
+
+ public:
+  /// initialize a ring in [start, start + size): the capacity is the largest power of 2 that fits
+  broadcast_ring_buffer(std::uintptr_t start, const std::size_t size) {
+    const std::size_t header_size = utils::align_up(sizeof(_s_header));
+    const std::uint64_t capacity = numeric::floor_to_power_of_two((size - header_size) / sizeof(_s_slot));
+    _header = std::construct_at(reinterpret_cast<_s_header*>(start));
+    _header->capacity = capacity;
+    _slots = std::span<_s_slot>(reinterpret_cast<_s_slot*>(start + header_size), capacity);
+    for (auto& slot : _slots) {
+      std::construct_at(std::addressof(slot));
+    }
+  }
+
+  /// attach to a ring that was initialized at start
+  explicit broadcast_ring_buffer(std::uintptr_t start) : _header(reinterpret_cast<_s_header*>(start)) {
+    _slots = std::span<_s_slot>(reinterpret_cast<_s_slot*>(start + utils::align_up(sizeof(_s_header))),
+                                _header->capacity);
+  }
+
+  broadcast_ring_buffer(const broadcast_ring_buffer& other) = default;
+  broadcast_ring_buffer(broadcast_ring_buffer&& other) = default;
+
+  broadcast_ring_buffer& operator=(const broadcast_ring_buffer& other) = default;
+  broadcast_ring_buffer& operator=(broadcast_ring_buffer&& other) noexcept = default;
+
+  /**
+   * @brief Append an element, overwriting the oldest one if the ring is full. Single producer only.
+   * @return index of the element
+   */
+  template <typename... T_Args>
+    requires std::is_constructible_v<T_p, T_Args...>
+  std::uint64_t emplace(T_Args&&... args) {
+    const T_p value(std::forward<T_Args>(args)...);
+    const std::uint64_t index = _header->next_index.load(std::memory_order_relaxed);
+    _s_slot& slot = _slots[index & (_slots.size() - 1)];
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(slot.data, std::addressof(value), sizeof(T_p));
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+    _header->next_index.store(index + 1, std::memory_order_release);
+    return index;
+  }
+
+  /**
+   * @brief Copy the element at cursor out and advance cursor.
+   *
+   * @return the element, or
+   *  - std::errc::no_message_available if the element was not written yet (cursor is unchanged)
+   *  - std::errc::value_too_large if the element was already overwritten: cursor is moved to the oldest element that
+   *    is still available, cursor - (old cursor) elements were lost
+   */
+  std::expected<T_p, std::error_code> try_read(std::uint64_t& cursor) const {
+    const _s_slot& slot = _slots[cursor & (_slots.size() - 1)];
+    const std::uint64_t expected_sequence = 2 * cursor + 2;
+    const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence < expected_sequence) {
+      return std::unexpected(std::make_error_code(std::errc::no_message_available));
+    }
+    if (sequence == expected_sequence) {
+      std::array<std::byte, sizeof(T_p)> bytes;
+      std::memcpy(bytes.data(), slot.data, sizeof(T_p));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) == expected_sequence) {
+        ++cursor;
+        // T_p does not need to be default constructible
+        return std::bit_cast<T_p>(bytes);
+      }
+    }
+    // overrun: the producer lapped us
+    cursor = std::max(cursor + 1, oldest_index());
+    return std::unexpected(std::make_error_code(std::errc::value_too_large));
+  }
+
+  /// index of the next element the producer writes (a new consumer starts here to only read new elements)
+  [[nodiscard]] std::uint64_t next_index() const { return _header->next_index.load(std::memory_order_acquire); }
+
+  /// index of the oldest element that is still available
+  [[nodiscard]] std::uint64_t oldest_index() const {
+    const std::uint64_t next = next_index();
+    return next > _slots.size() ? next - _slots.size() : 0;
+  }
+
+  [[nodiscard]] std::size_t size() const { return _slots.size(); }
+
+ private:
+  _s_header* _header = nullptr;
+  std::span<_s_slot> _slots;
+};
+
+}  // namespace ipcpp::shm
@@ -22,6 +22,8 @@ enum class error_t {
   anonymous_mapping_not_allowed,  // for windows, a file handle must be provided for memory mappings
   mapped_at_wrong_address,
   access_error,
+  lock_error,  // mlock fails
+  numa_error,  // mbind fails (e.g. a node of the mask does not exist)
   unknown_error,
 };
 
@@ -50,6 +52,10 @@ class error_category final : public std::error_category {
         return "mapped_at_wrong_address";
       case error_t::access_error:
         return "access_error";
+      case error_t::lock_error:
+        return "lock_error";
+      case error_t::numa_error:
+        return "numa_error";
       case error_t::unknown_error:
         return "unknown_error";
     }
@@ -0,0 +1,102 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <ipcpp/shm/shared_memory_file.h>
+#include <ipcpp/utils/platform.h>
+
+#include <chrono>
+#include <expected>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace ipcpp::shm {
+
+/**
+ * @brief Hands the handle of an anonymous shm object (see shared_memory_file::create_anonymous) to peers that connect
+ *  to name (Linux: abstract unix domain socket, SCM_RIGHTS).
+ *
+ * Only one process serves a name at a time: binding it is the per-topic creation lock, there is no global lock and no
+ *  file is left behind since abstract socket names vanish with their process. Processes that received the handle
+ *  keep a standby server connected to the serving process. The connection hangs up once that process exits and the
+ *  standby servers race for the name (see takeover_interval), so new peers can join as long as any process holds the
+ *  object.
+ *
+ * @remark like named shm objects (0666), the socket is reachable by every process of the network namespace.
+ */
+class IPCPP_API FdServer {
+ public:
+  typedef shared_memory_file::native_handle_t native_handle_t;
+
+  /**
+   * @brief Time a standby server is granted to take over after the serving process exited. Until then name is not
+   *  served: a process that is refused must wait for longer than that before it may create another object (see
+   *  get_memfd_entry).
+   */
+  static constexpr std::chrono::milliseconds takeover_interval = std::chrono::milliseconds(10);
+
+  FdServer(FdServer&& other) noexcept;
+  FdServer& operator=(FdServer&& other) noexcept;
+  ~FdServer();
+
+  /**
+   * @brief Serve handle under name. handle must stay valid for the lifetime of the server.
+   * @return std::errc::address_in_use if another process already serves name
+   */
+  static std::expected<FdServer, std::error_code> create(std::string_view name, native_handle_t handle);
+
+  /// serve handle under name as soon as the process that currently serves name exits
+  static std::expected<FdServer, std::error_code> standby(std::string_view name, native_handle_t handle);
+
+  /**
+   * @brief Receive the handle served under name. The caller owns the returned handle.
+   * @return std::errc::connection_refused if no process serves name
+   */
+  static std::expected<native_handle_t, std::error_code> receive(
+      std::string_view name, std::chrono::milliseconds timeout = std::chrono::milliseconds(100));
+
+  /// true if this process currently serves name
+  [[nodiscard]] bool is_serving() const;
+
+ private:
+  struct State;
+
+  explicit FdServer(std::unique_ptr<State>&& state);
+
+  /// shared with the serving thread, stable across moves
+  std::unique_ptr<State> _state;
+};
+
+/**
+ * @brief Inter-process lock identified by name that leaves nothing behind (Linux: bound abstract unix domain socket
+ *  like FdServer, Windows: named mutex). The lock is released on destruction or when the holding process exits.
+ */
+class IPCPP_API NameLock {
+ public:
+  NameLock(NameLock&& other) noexcept;
+  NameLock& operator=(NameLock&& other) noexcept;
+  ~NameLock();
+
+  /**
+   * @brief Block until name is locked.
+   * @return std::errc::timed_out if another process held name for longer than timeout
+   */
+  static std::expected<NameLock, std::error_code> acquire(
+      std::string_view name, std::chrono::milliseconds timeout = std::chrono::milliseconds(1000));
+
+ private:
+  struct State;
+
+  explicit NameLock(std::unique_ptr<State>&& state);
+
+  std::unique_ptr<State> _state;
+};
+
+}  // namespace ipcpp::shm
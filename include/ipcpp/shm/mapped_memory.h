@@ -9,6 +9,7 @@
 #pragma once
 
 #include <ipcpp/utils/platform.h>
+#include <ipcpp/shm/mapping_options.h>
 #include <ipcpp/shm/shared_memory_file.h>
 
 #include <cstdint>
@@ -28,9 +29,17 @@ class IPCPP_API MappedMemory {
 
   ~MappedMemory();
 
-  static std::expected<MappedMemory, std::error_code> create(std::string_view shm_id, std::size_t min_size);
+  static std::expected<MappedMemory, std::error_code> create(std::string_view shm_id, std::size_t min_size,
+                                                             const MappingOptions& options = {});
   static std::expected<MappedMemory, std::error_code> open(std::string_view shm_id,
-                                                           AccessMode access_mode = AccessMode::WRITE);
+                                                           AccessMode access_mode = AccessMode::WRITE,
+                                                           const MappingOptions& options = {});
+  /// map an already created/opened shm object (e.g. an anonymous one, see shared_memory_file::create_anonymous)
+  static std::expected<MappedMemory, std::error_code> create(shared_memory_file&& shm_file,
+                                                             const MappingOptions& options = {});
+  static std::expected<MappedMemory, std::error_code> open(shared_memory_file&& shm_file,
+                                                           AccessMode access_mode = AccessMode::WRITE,
+                                                           const MappingOptions& options = {});
 
   void msync(bool sync) const;
 
@@ -43,10 +52,6 @@ class IPCPP_API MappedMemory {
  private:
   explicit MappedMemory(shared_memory_file&& shm_file);
 
-  static std::expected<MappedMemory, std::error_code> create(shared_memory_file&& shm_file);
-  static std::expected<MappedMemory, std::error_code> open(shared_memory_file&& shm_file,
-                                                           AccessMode access_mode = AccessMode::WRITE);
-
   std::uintptr_t _mapped_region = 0;
   std::size_t _size = 0;
   std::size_t _total_size = 0;
@@ -58,4 +63,9 @@ std::expected<std::uintptr_t, std::error_code> IPCPP_API _map_memory(std::size_t
                                                            shared_memory_file::native_handle_t file_handle,
                                                            std::size_t offset, AccessMode access_mode);
 
+// _____________________________________________________________________________________________________________________
+/// apply options to a fresh mapping before it is touched (huge_tlb: the mapped shm object lives on hugetlbfs)
+std::error_code IPCPP_API _advise_memory(std::uintptr_t addr, std::size_t size, AccessMode access_mode,
+                                         const MappingOptions& options, bool huge_tlb);
+
 }  // namespace ipcpp::shm
\ No newline at end of file
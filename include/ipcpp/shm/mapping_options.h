@@ -0,0 +1,54 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ipcpp::shm {
+
+enum class HugePages {
+  None,         // regular pages
+  Transparent,  // regular shm object, the mapping is advised to use transparent huge pages (MADV_HUGEPAGE)
+  Explicit,     // shm object on hugetlbfs (reserved huge pages), falls back to Transparent if none are available
+};
+
+enum class MemoryLock {
+  None,
+  Locked,   // mlock: all pages are faulted in and never swapped out
+  OnFault,  // mlock2(MLOCK_ONFAULT): pages are locked once they are touched (combine with populate to fault them in)
+};
+
+enum class NumaPolicy {
+  Default,            // first touch: pages are allocated on the node of the thread that faults them in
+  Bind,               // pages are allocated on the nodes of numa_nodes only
+  Interleave,         // pages are interleaved across the nodes of numa_nodes
+  Preferred,          // pages are allocated on the lowest node of numa_nodes if possible
+  CallingThreadNode,  // Preferred with the node of the thread that maps the segment (numa_nodes is ignored)
+};
+
+/**
+ * @brief Options applied by MappedMemory when a shared memory segment is created or mapped.
+ */
+struct MappingOptions {
+  /// large segments (e.g. topic message pools) suffer from TLB misses on random access with regular pages
+  HugePages huge_pages = HugePages::None;
+  /// fault in all pages when mapping: the first access (e.g. the first publish into a slot) does not page fault
+  bool populate = false;
+  /// number of threads that populate the mapping in parallel (large segments, populate only)
+  std::size_t populate_threads = 1;
+  /// fails the mapping with error_t::lock_error if the pages cannot be locked (e.g. RLIMIT_MEMLOCK exceeded)
+  MemoryLock lock = MemoryLock::None;
+  /// applied before the segment is populated. The policy belongs to the shm object: it applies to all processes that
+  ///  map it (the topic creator should set it) and to pages that are not faulted in yet
+  NumaPolicy numa_policy = NumaPolicy::Default;
+  /// bit mask of numa nodes (bit i: node i) used by Bind, Interleave and Preferred
+  std::uint64_t numa_nodes = 0;
+};
+
+}  // namespace ipcpp::shm
@@ -29,15 +29,39 @@ class IPCPP_API shared_memory_file {
   shared_memory_file(shared_memory_file&& other) noexcept;
   shared_memory_file& operator=(shared_memory_file&& other) noexcept;
 
-  static std::expected<shared_memory_file, std::error_code> create(std::string&& path, std::size_t size);
+  /**
+   * @brief Create the shm object path with at least size bytes.
+   *
+   * @param huge_pages place the object on a hugetlbfs mount (size is rounded up to full huge pages). Falls back to a
+   *  regular shm object if no hugetlbfs is mounted or no huge pages are available, see is_huge_tlb().
+   */
+  static std::expected<shared_memory_file, std::error_code> create(std::string&& path, std::size_t size,
+                                                                   bool huge_pages = false);
+  /// opens regular as well as hugetlbfs backed shm objects
   static std::expected<shared_memory_file, std::error_code> open(std::string&& path, AccessMode access_mode = AccessMode::WRITE);
 
+  /**
+   * @brief Create an anonymous shm object (memfd) with at least size bytes. It has no path (name is used for debugging
+   *  only), nothing is left behind after a crash: the object is released once the last handle and mapping is closed.
+   *  The object is sealed against resizing so that peers it is handed to (see FdServer) can map it safely.
+   */
+  static std::expected<shared_memory_file, std::error_code> create_anonymous(std::string&& name, std::size_t size);
+  /**
+   * @brief Take ownership of a handle of an anonymous shm object created by another process (see FdServer::receive).
+   *  Fails if the object is not sealed against shrinking (a peer could otherwise invalidate our mapping).
+   */
+  static std::expected<shared_memory_file, std::error_code> from_native_handle(
+      std::string&& name, native_handle_t handle, AccessMode access_mode = AccessMode::WRITE);
+
   [[nodiscard]] const std::string& name() const;
   [[nodiscard]] std::size_t size() const;
   [[nodiscard]] native_handle_t native_handle() const;
 
   void unlink() const;
 
+  /// true if the object lives on hugetlbfs: every mapping of it is backed by huge pages
+  [[nodiscard]] bool is_huge_tlb() const;
+
  [[nodiscard]] AccessMode access_mode() const;
 
  private:
@@ -50,6 +74,9 @@ class IPCPP_API shared_memory_file {
   native_handle_t _native_handle = reinterpret_cast<native_handle_t>(0);
   std::size_t _size = 0U;
   bool _was_created = false;
+  bool _huge_tlb = false;
+  /// memfd: there is no path to unlink
+  bool _anonymous = false;
 };
 
 }
\ No newline at end of file
@@ -7,14 +7,17 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <memory>
-#include <unordered_map>
+#include <optional>
 #include <expected>
 #include <system_error>
 #include <mutex>
 
-#include <ipcpp/utils/file_lock.h>
+#include <ipcpp/shm/fd_server.h>
 #include <ipcpp/shm/mapped_memory.h>
 
 namespace ipcpp {
@@ -34,6 +37,11 @@ class ShmRegistryEntry final {
    */
   static std::string shm_name(std::string_view id);
 
+  /**
+   * @brief return the name of the socket the handle of an anonymous (memfd) shared memory object is served on
+   */
+  static std::string memfd_name(std::string_view id);
+
   /**
    * @brief returns original topic id
    * @return
@@ -51,12 +59,16 @@ class ShmRegistryEntry final {
   shm::MappedMemory<shm::MappingType::SINGLE>* operator->() { return std::addressof(_manually_managed_mm); }
 
  private:
-  ShmRegistryEntry(std::string id, shm::MappedMemory<shm::MappingType::SINGLE>&& mm) : _id(std::move(id)), _manually_managed_mm(std::move(mm)) {}
+  ShmRegistryEntry(std::string id, shm::MappedMemory<shm::MappingType::SINGLE>&& mm,
+                   std::optional<shm::FdServer>&& fd_server = std::nullopt)
+      : _id(std::move(id)), _manually_managed_mm(std::move(mm)), _fd_server(std::move(fd_server)) {}
 
  private:
   /// topic id
   std::string _id;
   shm::MappedMemory<shm::MappingType::SINGLE> _manually_managed_mm;
+  /// anonymous (memfd) shared memory only: serves the handle of _manually_managed_mm to peers (destroyed first)
+  std::optional<shm::FdServer> _fd_server;
 };
 
 struct TopicHash {
@@ -65,19 +77,66 @@ struct TopicHash {
   }
 };
 
+/**
+ * @brief Process wide cache of mapped shared memory entries.
+ *
+ * Entries are never removed: lookups of cached entries (the common case once a service is running) are lock free.
+ *  Creating an entry locks one bucket of the cache and, for named shared memory, a per-topic file lock, so that
+ *  processes and threads resolving different topics never serialize on a common lock.
+ */
 class ShmRegistry {
  public:
-  static std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> get_shm_entry(const std::string& id, std::size_t min_shm_size = 0);
+  /**
+   * @brief Open the shared memory of id or create it with at least min_shm_size bytes if it does not exist.
+   *
+   * @param options applied when the shared memory is mapped (by this process) for the first time
+   */
+  static std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> get_shm_entry(
+      const std::string& id, std::size_t min_shm_size = 0, const shm::MappingOptions& options = {});
+
+  /**
+   * @brief get_shm_entry backed by an anonymous shared memory object (memfd) instead of a named one. The handle is
+   *  received from a process that already holds the object or, if there is none, a new object is created (requires
+   *  min_shm_size > 0). No global lock is taken and nothing is left behind: the object is released once the last
+   *  process that holds it exits.
+   *
+   * @remark not supported on windows (std::errc::not_supported)
+   */
+  static std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> get_memfd_entry(
+      const std::string& id, std::size_t min_shm_size = 0, const shm::MappingOptions& options = {});
 
  private:
-  static std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> open_shm(const std::string& id);
-  static std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> create_shm(const std::string& id,
-                                                                                      std::size_t min_shm_size);
+  struct Node {
+    std::string id;
+    std::shared_ptr<ShmRegistryEntry> entry;
+    Node* next = nullptr;
+  };
+
+  /// insert only list of entries: readers traverse it without locking, writers prepend under mutex
+  struct Bucket {
+    std::atomic<Node*> head = nullptr;
+    std::mutex mutex;
+
+    ~Bucket();
+  };
 
-  static std::unordered_map<std::string, std::shared_ptr<ShmRegistryEntry>> _shm_registry;
-  static std::mutex _mutex;
+  static constexpr std::size_t num_buckets = 64;
+
+  static Bucket& bucket_of(std::string_view id);
+  static std::shared_ptr<ShmRegistryEntry> find_entry(const Bucket& bucket, std::string_view id);
+  /// bucket.mutex must be held
+  static std::shared_ptr<ShmRegistryEntry> insert_entry(Bucket& bucket, ShmRegistryEntry&& entry);
+
+  static std::expected<shm::MappedMemory<shm::MappingType::SINGLE>, std::error_code> open_or_create_shm(
+      const std::string& id, std::size_t min_shm_size, const shm::MappingOptions& options);
+
+  static std::array<Bucket, num_buckets> _buckets;
 };
 
-std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> get_shm_entry(const std::string& id, std::size_t min_shm_size = 0);
+std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> get_shm_entry(
+    const std::string& id, std::size_t min_shm_size = 0, const shm::MappingOptions& options = {});
+
+std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> get_memfd_entry(
+    const std::string& id, std::size_t min_shm_size = 0, const shm::MappingOptions& options = {});
 
 }  // namespace ipcpp
\ No newline at end of file
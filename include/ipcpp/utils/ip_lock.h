@@ -4,6 +4,7 @@
 #include <system_error>
 #include <string>
 #include <filesystem>
+#include <format>
 
 #include <ipcpp/utils/platform.h>
 
@@ -13,6 +14,7 @@
 #include <system_error>
 #else
 #include <fcntl.h>
+#include <sys/file.h>
 #include <unistd.h>
 #include <system_error>
 #endif
@@ -117,15 +119,10 @@ struct InterProcessLock::Impl {
     }
   }
 
-  // Exclusive lock (write lock)
+  // Exclusive lock (write lock). flock locks belong to the open file description (not to the process like fcntl
+  //  locks), so two InterProcessLocks of the same name also exclude each other within one process.
   std::error_code lock() const {
-    struct flock fl = {};
-    fl.l_type = F_WRLCK;
-    fl.l_whence = SEEK_SET;
-    fl.l_start = 0;
-    fl.l_len = 0;
-
-    if (fcntl(_fd, F_SETLKW, &fl) == -1) {
+    if (flock(_fd, LOCK_EX) == -1) {
       return std::error_code(errno, std::system_category());
     }
     return {};
@@ -133,28 +130,16 @@ struct InterProcessLock::Impl {
 
   // Unlock the file
   void unlock() const {
-    struct flock fl = {};
-    fl.l_type = F_UNLCK;
-    fl.l_whence = SEEK_SET;
-    fl.l_start = 0;
-    fl.l_len = 0;
-
-    if (fcntl(_fd, F_SETLK, &fl) == -1) {
+    if (flock(_fd, LOCK_UN) == -1) {
       throw std::system_error(errno, std::generic_category(), "Failed to unlock file");
     }
   }
 
   // Try to acquire an exclusive lock (write lock) without blocking
   [[nodiscard]] std::error_code try_lock(bool& acquired) const {
-    struct flock fl = {};
-    fl.l_type = F_WRLCK;
-    fl.l_whence = SEEK_SET;
-    fl.l_start = 0;
-    fl.l_len = 0;
-
-    if (fcntl(_fd, F_SETLK, &fl) == -1) {
+    if (flock(_fd, LOCK_EX | LOCK_NB) == -1) {
       acquired = false;
-      if (errno == EAGAIN || errno == EACCES) {
+      if (errno == EWOULDBLOCK) {
         return {};
       }
       return std::error_code(errno, std::system_category());
@@ -10,6 +10,8 @@
 #include <ipcpp/utils/concepts.h>
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <thread>
 #include <mutex>
 
@@ -17,11 +19,16 @@
 #include <linux/futex.h>
 #include <sys/syscall.h>
 #include <unistd.h>
+
+#include <ctime>
 #endif
 
 #include <cassert>
+#include <cerrno>
 #include <climits>
 #include <cstdint>
+#include <optional>
+#include <span>
 
 namespace ipcpp {
 
@@ -32,6 +39,109 @@ void wait(const std::atomic<T>& value, const T old, const std::memory_order orde
   }
 }
 
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t) &&
+                  std::atomic<std::uint32_t>::is_always_lock_free,
+              "futex words must be plain 32 bit integers");
+
+/**
+ * @brief Blocks the calling thread as long as word holds expected. The word may live in shared memory: waiters and
+ *  wakers of different processes meet on the same physical address (no FUTEX_PRIVATE_FLAG).
+ *
+ * @remark spurious wake ups are possible, callers must re-check their condition.
+ * @remark falls back to std::this_thread::yield() on platforms without futex support.
+ */
+inline void futex_wait(std::atomic<std::uint32_t>& word, const std::uint32_t expected) noexcept {
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, expected, nullptr, nullptr, 0);
+#else
+  if (word.load(std::memory_order_acquire) == expected) {
+    std::this_thread::yield();
+  }
+#endif
+}
+
+/**
+ * @brief futex_wait with a relative timeout.
+ *
+ * @return false if the timeout expired, true otherwise (woken up, spurious wake up or word != expected)
+ */
+inline bool futex_wait(std::atomic<std::uint32_t>& word, const std::uint32_t expected,
+                       const std::chrono::nanoseconds timeout) noexcept {
+#ifdef __linux__
+  const timespec ts{.tv_sec = static_cast<time_t>(timeout.count() / 1'000'000'000),
+                    .tv_nsec = static_cast<long>(timeout.count() % 1'000'000'000)};
+  return syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, expected, &ts, nullptr, 0) != -1 ||
+         errno != ETIMEDOUT;
+#else
+  if (word.load(std::memory_order_acquire) == expected) {
+    std::this_thread::yield();
+  }
+  return true;
+#endif
+}
+
+/**
+ * @brief Wakes up to num_waiters threads blocked in futex_wait on word.
+ */
+inline void futex_wake(std::atomic<std::uint32_t>& word, const int num_waiters = INT_MAX) noexcept {
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, num_waiters, nullptr, nullptr, 0);
+#endif
+}
+
+/**
+ * @brief Futex word and waiter count of a wait queue that possibly lives in shared memory. Waiters increase
+ *  num_waiters before they park on futex, wakers increase futex and only issue a FUTEX_WAKE if num_waiters is not 0.
+ */
+struct FutexWaitHandle {
+  std::atomic<std::uint32_t>* futex = nullptr;
+  std::atomic<std::uint32_t>* num_waiters = nullptr;
+};
+
+/// maximum number of words futex_wait_any can wait on
+#if defined(__linux__) && defined(SYS_futex_waitv) && defined(FUTEX_WAITV_MAX)
+inline constexpr std::size_t futex_wait_any_max = FUTEX_WAITV_MAX;
+#else
+inline constexpr std::size_t futex_wait_any_max = 128;
+#endif
+
+/**
+ * @brief Blocks the calling thread as long as all words[i] hold expected[i] (futex_waitv, Linux >= 5.16).
+ *
+ * @param deadline absolute steady_clock time point, std::nullopt waits forever
+ * @return index of the word whose waker woke us up, -1 on timeout, if a word did not hold its expected value or on
+ *  spurious wake ups (callers must re-check their conditions)
+ *
+ * @remark falls back to std::this_thread::yield() if futex_waitv is not available.
+ */
+inline int futex_wait_any(std::span<std::atomic<std::uint32_t>* const> words, std::span<const std::uint32_t> expected,
+                          const std::optional<std::chrono::steady_clock::time_point> deadline = std::nullopt) noexcept {
+  assert(words.size() == expected.size() && words.size() <= futex_wait_any_max);
+#if defined(__linux__) && defined(SYS_futex_waitv) && defined(FUTEX_WAITV_MAX)
+  futex_waitv waiters[FUTEX_WAITV_MAX]{};
+  for (std::size_t i = 0; i < words.size(); ++i) {
+    waiters[i].val = expected[i];
+    waiters[i].uaddr = reinterpret_cast<std::uintptr_t>(words[i]);
+    waiters[i].flags = FUTEX_32;
+  }
+  timespec ts{};
+  if (deadline.has_value()) {
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline->time_since_epoch()).count();
+    ts = {.tv_sec = static_cast<time_t>(ns / 1'000'000'000), .tv_nsec = static_cast<long>(ns % 1'000'000'000)};
+  }
+  // steady_clock is CLOCK_MONOTONIC on Linux
+  const long result = syscall(SYS_futex_waitv, waiters, static_cast<unsigned>(words.size()), 0,
+                              deadline.has_value() ? &ts : nullptr, CLOCK_MONOTONIC);
+  if (result == -1 && errno == ENOSYS) {
+    std::this_thread::yield();
+  }
+  return static_cast<int>(result);
+#else
+  std::this_thread::yield();
+  return -1;
+#endif
+}
+
 /**
  * @brief mutex implementation according to std::mutex (except for mutex::is_locked which is added for checks in debug
  *  mode). Fulfills the requirements of a mutex according to the c++ standard.
@@ -170,6 +280,89 @@ class shared_mutex {
 static_assert(concepts::shared_mutex<shared_mutex>,
               "ipcpp::shared_mutex does not fulfill the requirements of shared_mutex");
 
+/**
+ * @brief Condition variable built on a futex word. Unlike std::condition_variable it can be placed in shared memory
+ *  and used across processes (valid if zero initialized). Works with every lockable that is process-shared as well
+ *  (e.g. ipcpp::futex, ipcpp::mutex).
+ *
+ * @remark notify_one()/notify_all() only issue a FUTEX_WAKE if a thread is waiting.
+ */
+class condition_variable {
+ public:
+  condition_variable() = default;
+
+  condition_variable(const condition_variable&) = delete;
+  condition_variable& operator=(const condition_variable&) = delete;
+
+  void notify_one() noexcept { _m_notify(1); }
+
+  void notify_all() noexcept { _m_notify(INT_MAX); }
+
+  /**
+   * @brief Atomically release lock and block until notified. lock is re-acquired before returning, spurious wake ups
+   *  are possible.
+   */
+  template <concepts::basic_lockable T_Lock>
+  void wait(T_Lock& lock) {
+    // read while lock is held: a notifier changes the protected state under lock before it bumps _sequence
+    const std::uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+    _num_waiters.fetch_add(1, std::memory_order_seq_cst);
+    lock.unlock();
+    futex_wait(_sequence, sequence);
+    _num_waiters.fetch_sub(1, std::memory_order_release);
+    lock.lock();
+  }
+
+  template <concepts::basic_lockable T_Lock, typename T_Predicate>
+  void wait(T_Lock& lock, T_Predicate predicate) {
+    while (!predicate()) {
+      wait(lock);
+    }
+  }
+
+  /**
+   * @brief wait() with a relative timeout.
+   * @return std::cv_status::timeout if the timeout expired
+   */
+  template <concepts::basic_lockable T_Lock>
+  std::cv_status wait_for(T_Lock& lock, const std::chrono::nanoseconds timeout) {
+    const std::uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+    _num_waiters.fetch_add(1, std::memory_order_seq_cst);
+    lock.unlock();
+    const bool woken = futex_wait(_sequence, sequence, timeout);
+    _num_waiters.fetch_sub(1, std::memory_order_release);
+    lock.lock();
+    return woken ? std::cv_status::no_timeout : std::cv_status::timeout;
+  }
+
+  /**
+   * @return predicate() after waking up (false if the timeout expired before predicate became true)
+   */
+  template <concepts::basic_lockable T_Lock, typename T_Predicate>
+  bool wait_for(T_Lock& lock, const std::chrono::nanoseconds timeout, T_Predicate predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+      const auto remaining = deadline - std::chrono::steady_clock::now();
+      if (remaining <= std::chrono::nanoseconds::zero() || wait_for(lock, remaining) == std::cv_status::timeout) {
+        return predicate();
+      }
+    }
+    return true;
+  }
+
+ private:
+  void _m_notify(const int num_threads) noexcept {
+    _sequence.fetch_add(1, std::memory_order_seq_cst);
+    if (_num_waiters.load(std::memory_order_seq_cst) > 0) {
+      futex_wake(_sequence, num_threads);
+    }
+  }
+
+ private:
+  std::atomic<std::uint32_t> _sequence = 0;
+  std::atomic<std::uint32_t> _num_waiters = 0;
+};
+
 #ifdef __linux__
 
 class futex {
@@ -11,6 +11,9 @@
 
 #include <concepts>
 #include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
 #if defined(IPCPP_WINDOWS)
 #define NOMINMAX
 #define WIN32_LEAN_AND_MEAN
@@ -25,7 +28,7 @@ namespace ipcpp::utils::system {
 
 namespace internal {
 
-size_t get_page_size(void) {
+inline size_t get_page_size(void) {
   static size_t page_size = 0;
 
   if (page_size == 0) {
@@ -41,6 +44,33 @@ size_t get_page_size(void) {
   return page_size;
 }
 
+/**
+ * @brief Default huge page size of the system (Hugepagesize in /proc/meminfo, GetLargePageMinimum on windows).
+ * @return 0 if huge pages are not supported
+ */
+inline size_t get_huge_page_size() {
+  static const size_t huge_page_size = []() -> size_t {
+#if defined(IPCPP_WINDOWS)
+    return GetLargePageMinimum();
+#elif defined(__linux__)
+    std::ifstream meminfo("/proc/meminfo");
+    std::string key;
+    while (meminfo >> key) {
+      if (key == "Hugepagesize:") {
+        size_t size_kib = 0;
+        meminfo >> size_kib;
+        return size_kib * 1024;
+      }
+      meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return 0;
+#else
+    return 0;
+#endif
+  }();
+  return huge_page_size;
+}
+
 }  // namespace internal
 
 template <typename T>
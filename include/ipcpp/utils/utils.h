@@ -5,10 +5,15 @@
 #pragma once
 
 #include <ipcpp/utils/platform.h>
+#include <ipcpp/utils/system.h>
 
 #include <chrono>
 #include <filesystem>
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
 namespace ipcpp::utils {
 
 inline int64_t timestamp() {
@@ -16,10 +21,43 @@ inline int64_t timestamp() {
       .count();
 }
 
+/**
+ * @brief Tells the CPU that the caller is spinning in a busy wait loop (pause/yield instruction).
+ */
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
 inline std::size_t align_up(const std::size_t size, const std::size_t alignment = 16) {
   return (size + alignment - 1) & ~(alignment - 1);
 }
 
+enum class PageSize {
+  Regular,  // the systems base page size (e.g. 4 KiB)
+  Huge,     // the systems default huge page size (e.g. 2 MiB), regular pages if huge pages are not supported
+};
+
+[[nodiscard]] inline std::size_t page_size(const PageSize page_size) {
+  if (page_size == PageSize::Huge) {
+    if (const std::size_t huge_page_size = system::internal::get_huge_page_size(); huge_page_size != 0) {
+      return huge_page_size;
+    }
+  }
+  return system::internal::get_page_size();
+}
+
+/**
+ * @brief Round size up to full pages, e.g. for sizes of shared memory segments (huge page backed segments must be a
+ *  multiple of the huge page size).
+ */
+inline std::size_t align_up(const std::size_t size, const PageSize page_size) {
+  return align_up(size, utils::page_size(page_size));
+}
+
 template <typename T>
 std::string to_string(T& value) {
   std::stringstream ss;
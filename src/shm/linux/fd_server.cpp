@@ -0,0 +1,391 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <ipcpp/utils/platform.h>
+
+#ifdef IPCPP_UNIX
+
+#include <ipcpp/shm/fd_server.h>
+#include <ipcpp/utils/logging.h>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace ipcpp::shm {
+
+namespace {
+
+/// standby servers that can neither serve nor connect to the serving process (it did not listen yet) retry after this
+constexpr int retry_interval_ms = 1;
+
+/// abstract socket address of name: sun_path starts with '\0', the address is not null terminated
+std::expected<std::pair<sockaddr_un, socklen_t>, std::error_code> abstract_address(const std::string_view name) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (name.size() + 1 > sizeof(address.sun_path)) {
+    return std::unexpected(std::make_error_code(std::errc::filename_too_long));
+  }
+  std::memcpy(address.sun_path + 1, name.data(), name.size());
+  return std::make_pair(address, static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + 1 + name.size()));
+}
+
+/// listening socket bound to address, -1 if it is bound by another process
+int bind_socket(const std::pair<sockaddr_un, socklen_t>& address) {
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd == -1) {
+    return -1;
+  }
+  if (::bind(fd, reinterpret_cast<const sockaddr*>(&address.first), address.second) == -1 || ::listen(fd, 64) == -1) {
+    const int error = errno;
+    ::close(fd);
+    errno = error;
+    return -1;
+  }
+  return fd;
+}
+
+/// socket bound to address without listening (NameLock), -1 if it is bound by another process
+int bind_unconnected(const std::pair<sockaddr_un, socklen_t>& address) {
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd == -1) {
+    return -1;
+  }
+  if (::bind(fd, reinterpret_cast<const sockaddr*>(&address.first), address.second) == -1) {
+    const int error = errno;
+    ::close(fd);
+    errno = error;
+    return -1;
+  }
+  return fd;
+}
+
+/// socket connected to address, -1 if nobody listens on it
+int connect_socket(const std::pair<sockaddr_un, socklen_t>& address) {
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd == -1) {
+    return -1;
+  }
+  if (::connect(fd, reinterpret_cast<const sockaddr*>(&address.first), address.second) == -1) {
+    const int error = errno;
+    ::close(fd);
+    errno = error;
+    return -1;
+  }
+  return fd;
+}
+
+/// send handle as SCM_RIGHTS ancillary data of a single byte message
+bool send_handle(const int socket, const int handle) {
+  char byte = 0;
+  iovec io{.iov_base = &byte, .iov_len = 1};
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))]{};
+  msghdr message{};
+  message.msg_iov = &io;
+  message.msg_iovlen = 1;
+  message.msg_control = control;
+  message.msg_controllen = sizeof(control);
+  cmsghdr* header = CMSG_FIRSTHDR(&message);
+  header->cmsg_level = SOL_SOCKET;
+  header->cmsg_type = SCM_RIGHTS;
+  header->cmsg_len = CMSG_LEN(sizeof(int));
+  std::memcpy(CMSG_DATA(header), &handle, sizeof(int));
+  return ::sendmsg(socket, &message, MSG_NOSIGNAL) == 1;
+}
+
+/**
+ * @brief Receive a message sent by send_handle.
+ * @return the result of recvmsg, handle is set to the received handle (-1 if none was attached)
+ */
+ssize_t receive_handle(const int socket, int& handle, const int flags) {
+  char byte = 0;
+  iovec io{.iov_base = &byte, .iov_len = 1};
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))]{};
+  msghdr message{};
+  message.msg_iov = &io;
+  message.msg_iovlen = 1;
+  message.msg_control = control;
+  message.msg_controllen = sizeof(control);
+  handle = -1;
+  const ssize_t received = ::recvmsg(socket, &message, flags | MSG_CMSG_CLOEXEC);
+  if (received <= 0) {
+    return received;
+  }
+  if (const cmsghdr* header = CMSG_FIRSTHDR(&message);
+      header != nullptr && header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS) {
+    std::memcpy(&handle, CMSG_DATA(header), sizeof(int));
+  }
+  return received;
+}
+
+/// true if both handles refer to the same object
+bool same_object(const int lhs, const int rhs) {
+  struct stat lhs_stat{};
+  struct stat rhs_stat{};
+  return ::fstat(lhs, &lhs_stat) == 0 && ::fstat(rhs, &rhs_stat) == 0 && lhs_stat.st_dev == rhs_stat.st_dev &&
+         lhs_stat.st_ino == rhs_stat.st_ino;
+}
+
+}  // namespace
+
+struct FdServer::State {
+  std::pair<sockaddr_un, socklen_t> address{};
+  native_handle_t handle = -1;
+  /// listening socket, -1 while on standby (only accessed by thread once it is started)
+  int socket = -1;
+  /// connection to the serving process while on standby: it hangs up once that process exits
+  int server = -1;
+  /// set if another object is served under name: this server never takes over
+  bool orphaned = false;
+  /// connections of peers the handle was sent to: standby servers keep theirs open
+  std::vector<int> clients;
+  /// written by the destructor to wake up thread
+  int wakeup = -1;
+  std::atomic_bool serving = false;
+  std::jthread thread;
+
+  ~State() {
+    if (thread.joinable()) {
+      thread.request_stop();
+      const std::uint64_t one = 1;
+      static_cast<void>(::write(wakeup, &one, sizeof(one)));
+      thread.join();
+    }
+    // closing the connections wakes up the standby servers of other processes
+    for (const int client : clients) {
+      ::close(client);
+    }
+    for (const int fd : {socket, server, wakeup}) {
+      if (fd != -1) {
+        ::close(fd);
+      }
+    }
+  }
+
+  void run(const std::stop_token& stop_token) {
+    std::vector<pollfd> fds;
+    while (!stop_token.stop_requested()) {
+      if (socket == -1 && server == -1 && !orphaned) {
+        _m_take_over_or_watch();
+      }
+      const bool retry = socket == -1 && server == -1 && !orphaned;
+      // poll ignores negative fds: socket while on standby, server while serving
+      fds.assign({{.fd = wakeup, .events = POLLIN, .revents = 0},
+                  {.fd = socket, .events = POLLIN, .revents = 0},
+                  {.fd = server, .events = POLLIN, .revents = 0}});
+      for (const int client : clients) {
+        fds.push_back({.fd = client, .events = POLLIN, .revents = 0});
+      }
+      if (::poll(fds.data(), fds.size(), retry ? retry_interval_ms : -1) <= 0) {
+        continue;
+      }
+      if (fds[2].revents != 0) {
+        _m_on_server_event();
+      }
+      // peers close their connection once they received the handle, standby servers once their process exits
+      for (std::size_t idx = fds.size(); idx-- > 3;) {
+        if (fds[idx].revents == 0) {
+          continue;
+        }
+        char byte = 0;
+        if (const ssize_t received = ::recv(fds[idx].fd, &byte, 1, MSG_DONTWAIT);
+            received == -1 && (errno == EAGAIN || errno == EINTR)) {
+          continue;
+        }
+        ::close(fds[idx].fd);
+        clients.erase(clients.begin() + static_cast<std::ptrdiff_t>(idx - 3));
+      }
+      if ((fds[1].revents & POLLIN) == 0) {
+        continue;
+      }
+      if (const int client = ::accept4(socket, nullptr, nullptr, SOCK_CLOEXEC); client != -1) {
+        if (!send_handle(client, handle)) {
+          logging::warn("FdServer: sending handle failed: {}", std::strerror(errno));
+          ::close(client);
+          continue;
+        }
+        clients.push_back(client);
+      }
+    }
+  }
+
+ private:
+  /// serve name or, if another process serves it, connect to that process to get woken up once it exits
+  void _m_take_over_or_watch() {
+    socket = bind_socket(address);
+    serving.store(socket != -1, std::memory_order_release);
+    if (socket == -1) {
+      // -1 if the serving process bound name but does not listen yet: retried after retry_interval_ms
+      server = connect_socket(address);
+    }
+  }
+
+  /// the serving process sent the handle or exited
+  void _m_on_server_event() {
+    int received_handle = -1;
+    const ssize_t received = receive_handle(server, received_handle, MSG_DONTWAIT);
+    if (received == -1 && (errno == EAGAIN || errno == EINTR)) {
+      return;
+    }
+    if (received > 0) {
+      if (received_handle != -1) {
+        // a process created another object while no one served name: taking over would serve a different one
+        orphaned = !same_object(handle, received_handle);
+        ::close(received_handle);
+      }
+      if (!orphaned) {
+        return;
+      }
+      logging::warn("FdServer: another object is served under this name, standby server stopped");
+    }
+    ::close(server);
+    server = -1;
+  }
+};
+
+// _____________________________________________________________________________________________________________________
+FdServer::FdServer(std::unique_ptr<State>&& state) : _state(std::move(state)) {}
+
+// _____________________________________________________________________________________________________________________
+FdServer::FdServer(FdServer&& other) noexcept = default;
+
+// _____________________________________________________________________________________________________________________
+FdServer& FdServer::operator=(FdServer&& other) noexcept = default;
+
+// _____________________________________________________________________________________________________________________
+FdServer::~FdServer() = default;
+
+// _____________________________________________________________________________________________________________________
+std::expected<FdServer, std::error_code> FdServer::create(const std::string_view name, const native_handle_t handle) {
+  auto address = abstract_address(name);
+  if (!address.has_value()) {
+    return std::unexpected(address.error());
+  }
+  auto state = std::make_unique<State>();
+  state->address = address.value();
+  state->handle = handle;
+  state->socket = bind_socket(state->address);
+  if (state->socket == -1) {
+    return std::unexpected(std::error_code(errno, std::generic_category()));
+  }
+  state->serving.store(true, std::memory_order_relaxed);
+  state->wakeup = ::eventfd(0, EFD_CLOEXEC);
+  if (state->wakeup == -1) {
+    return std::unexpected(std::error_code(errno, std::generic_category()));
+  }
+  state->thread = std::jthread([raw = state.get()](const std::stop_token& stop_token) { raw->run(stop_token); });
+  return FdServer(std::move(state));
+}
+
+// _____________________________________________________________________________________________________________________
+std::expected<FdServer, std::error_code> FdServer::standby(const std::string_view name, const native_handle_t handle) {
+  auto address = abstract_address(name);
+  if (!address.has_value()) {
+    return std::unexpected(address.error());
+  }
+  auto state = std::make_unique<State>();
+  state->address = address.value();
+  state->handle = handle;
+  state->wakeup = ::eventfd(0, EFD_CLOEXEC);
+  if (state->wakeup == -1) {
+    return std::unexpected(std::error_code(errno, std::generic_category()));
+  }
+  state->thread = std::jthread([raw = state.get()](const std::stop_token& stop_token) { raw->run(stop_token); });
+  return FdServer(std::move(state));
+}
+
+// _____________________________________________________________________________________________________________________
+std::expected<FdServer::native_handle_t, std::error_code> FdServer::receive(const std::string_view name,
+                                                                            const std::chrono::milliseconds timeout) {
+  auto address = abstract_address(name);
+  if (!address.has_value()) {
+    return std::unexpected(address.error());
+  }
+  const int socket = connect_socket(address.value());
+  if (socket == -1) {
+    return std::unexpected(std::error_code(errno, std::generic_category()));
+  }
+  const timeval receive_timeout{.tv_sec = static_cast<time_t>(timeout.count() / 1000),
+                                .tv_usec = static_cast<suseconds_t>((timeout.count() % 1000) * 1000)};
+  setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &receive_timeout, sizeof(receive_timeout));
+
+  int handle = -1;
+  const ssize_t received = receive_handle(socket, handle, 0);
+  const int error = errno;
+  ::close(socket);
+  if (received == -1) {
+    return std::unexpected(std::error_code(error, std::generic_category()));
+  }
+  if (received == 0 || handle == -1) {
+    // the serving process exited before it handed out the handle
+    return std::unexpected(std::make_error_code(std::errc::connection_reset));
+  }
+  return handle;
+}
+
+// _____________________________________________________________________________________________________________________
+bool FdServer::is_serving() const { return _state && _state->serving.load(std::memory_order_acquire); }
+
+// === NameLock ========================================================================================================
+struct NameLock::State {
+  /// the bound socket is the lock: the name is released once it is closed (by us or the kernel on exit)
+  int socket = -1;
+
+  ~State() {
+    if (socket != -1) {
+      ::close(socket);
+    }
+  }
+};
+
+// _____________________________________________________________________________________________________________________
+NameLock::NameLock(std::unique_ptr<State>&& state) : _state(std::move(state)) {}
+
+// _____________________________________________________________________________________________________________________
+NameLock::NameLock(NameLock&& other) noexcept = default;
+
+// _____________________________________________________________________________________________________________________
+NameLock& NameLock::operator=(NameLock&& other) noexcept = default;
+
+// _____________________________________________________________________________________________________________________
+NameLock::~NameLock() = default;
+
+// _____________________________________________________________________________________________________________________
+std::expected<NameLock, std::error_code> NameLock::acquire(const std::string_view name,
+                                                           const std::chrono::milliseconds timeout) {
+  auto address = abstract_address(name);
+  if (!address.has_value()) {
+    return std::unexpected(address.error());
+  }
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  auto state = std::make_unique<State>();
+  while ((state->socket = bind_unconnected(address.value())) == -1) {
+    if (errno != EADDRINUSE) {
+      return std::unexpected(std::error_code(errno, std::generic_category()));
+    }
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return std::unexpected(std::make_error_code(std::errc::timed_out));
+    }
+    // holders only keep the lock for a few syscalls
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  return NameLock(std::move(state));
+}
+
+}  // namespace ipcpp::shm
+
+#endif
@@ -11,8 +11,20 @@
 
 #include <ipcpp/shm/mapped_memory.h>
 #include <ipcpp/utils/logging.h>
+#include <ipcpp/utils/utils.h>
 
+#include <linux/mempolicy.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <thread>
+#include <vector>
 
 namespace ipcpp::shm {
 
@@ -45,6 +57,134 @@ std::expected<std::uintptr_t, std::error_code> _map_memory(const std::size_t exp
   return reinterpret_cast<std::uintptr_t>(mapped_region);
 }
 
+// === private definition: advise_memory: linux (posix) implementation =================================================
+// _____________________________________________________________________________________________________________________
+namespace {
+
+/**
+ * @brief Fault in all pages of [addr, addr + size). Prefers MADV_POPULATE_(READ|WRITE) (linux >= 5.14), falls back to
+ *  touching one byte per page: writable mappings are touched with an atomic no-op so that data of already initialized
+ *  segments is neither changed nor raced.
+ */
+void populate_range(const std::uintptr_t addr, const std::size_t size, const AccessMode access_mode) {
+#if defined(MADV_POPULATE_READ) && defined(MADV_POPULATE_WRITE)
+  const int advice = access_mode == AccessMode::WRITE ? MADV_POPULATE_WRITE : MADV_POPULATE_READ;
+  if (::madvise(reinterpret_cast<void*>(addr), size, advice) == 0) {
+    return;
+  }
+#endif
+  const std::size_t page_size = utils::page_size(utils::PageSize::Regular);
+  for (std::uintptr_t page = addr; page < addr + size; page += page_size) {
+    if (access_mode == AccessMode::WRITE) {
+      std::atomic_ref(*reinterpret_cast<std::uint8_t*>(page)).fetch_or(0, std::memory_order_relaxed);
+    } else {
+      static_cast<void>(*reinterpret_cast<const volatile std::uint8_t*>(page));
+    }
+  }
+}
+
+/// split [addr, addr + size) into page aligned chunks that are populated by num_threads threads
+void populate(const std::uintptr_t addr, const std::size_t size, const AccessMode access_mode,
+              const std::size_t num_threads) {
+  const std::size_t chunk_size =
+      utils::align_up((size + num_threads - 1) / std::max<std::size_t>(num_threads, 1), utils::PageSize::Huge);
+  if (num_threads <= 1 || chunk_size >= size) {
+    populate_range(addr, size, access_mode);
+    return;
+  }
+  std::vector<std::jthread> threads;
+  for (std::size_t offset = 0; offset < size; offset += chunk_size) {
+    threads.emplace_back(populate_range, addr + offset, std::min(chunk_size, size - offset), access_mode);
+  }
+}
+
+/// set the numa memory policy of [addr, addr + size), pages that are already faulted in are not migrated
+std::error_code bind_memory(const std::uintptr_t addr, const std::size_t size, const NumaPolicy policy,
+                            std::uint64_t nodes) {
+  int mode = MPOL_DEFAULT;
+  switch (policy) {
+    case NumaPolicy::Default:
+      return {};
+    case NumaPolicy::Bind:
+      mode = MPOL_BIND;
+      break;
+    case NumaPolicy::Interleave:
+      mode = MPOL_INTERLEAVE;
+      break;
+    case NumaPolicy::Preferred:
+      mode = MPOL_PREFERRED;
+      nodes &= ~nodes + 1;
+      break;
+    case NumaPolicy::CallingThreadNode: {
+      unsigned cpu = 0;
+      unsigned node = 0;
+      if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == -1) {
+        logging::warn("_advise_memory: getcpu failed: {}", std::strerror(errno));
+        return {static_cast<int>(error_t::numa_error), error_category()};
+      }
+      mode = MPOL_PREFERRED;
+      nodes = std::uint64_t{1} << node;
+      break;
+    }
+  }
+  if (nodes == 0) {
+    logging::warn("_advise_memory: numa policy requires at least one node");
+    return {static_cast<int>(error_t::numa_error), error_category()};
+  }
+  unsigned long node_mask = nodes;
+  // the kernel reads maxnode - 1 bits
+  if (::syscall(SYS_mbind, addr, size, mode, &node_mask, sizeof(node_mask) * CHAR_BIT + 1, 0) == -1) {
+    if (errno == ENOSYS) {
+      // kernel without numa support: there is only one node
+      logging::debug("_advise_memory: mbind not supported");
+      return {};
+    }
+    logging::warn("_advise_memory: mbind failed: {}", std::strerror(errno));
+    return {static_cast<int>(error_t::numa_error), error_category()};
+  }
+  return {};
+}
+
+}  // namespace
+
+// _____________________________________________________________________________________________________________________
+std::error_code _advise_memory(const std::uintptr_t addr, const std::size_t size, const AccessMode access_mode,
+                               const MappingOptions& options, const bool huge_tlb) {
+  // hugetlbfs backed objects are mapped with huge pages anyway
+  if (options.huge_pages != HugePages::None && !huge_tlb) {
+    // fails if the kernel has no transparent huge page support, shmem THP is controlled by
+    //  /sys/kernel/mm/transparent_hugepage/shmem_enabled ("advise" or "always")
+    if (::madvise(reinterpret_cast<void*>(addr), size, MADV_HUGEPAGE) == -1) {
+      logging::debug("_advise_memory: madvise(MADV_HUGEPAGE) failed: {}", std::strerror(errno));
+    }
+  }
+  // must be applied before first touch, pages that are already faulted in stay where they are
+  if (auto error = bind_memory(addr, size, options.numa_policy, options.numa_nodes); error) {
+    return error;
+  }
+  // populated after advising (instead of MAP_POPULATE at mmap) so that pages are faulted in as advised
+  if (options.populate) {
+    populate(addr, size, access_mode, options.populate_threads);
+  }
+  switch (options.lock) {
+    case MemoryLock::None:
+      break;
+    case MemoryLock::Locked:
+      if (::mlock(reinterpret_cast<void*>(addr), size) == -1) {
+        logging::warn("_advise_memory: mlock failed: {}", std::strerror(errno));
+        return {static_cast<int>(error_t::lock_error), error_category()};
+      }
+      break;
+    case MemoryLock::OnFault:
+      if (::mlock2(reinterpret_cast<void*>(addr), size, MLOCK_ONFAULT) == -1) {
+        logging::warn("_advise_memory: mlock2(MLOCK_ONFAULT) failed: {}", std::strerror(errno));
+        return {static_cast<int>(error_t::lock_error), error_category()};
+      }
+      break;
+  }
+  return {};
+}
+
 // === member function definitions: platform specific implementation ===================================================
 // ___ msync ___________________________________________________________________________________________________________
 // _____________________________________________________________________________________________________________________
@@ -10,6 +10,7 @@
 #ifdef IPCPP_UNIX
 
 #include <ipcpp/shm/shared_memory_file.h>
+#include <ipcpp/utils/logging.h>
 #include <ipcpp/utils/utils.h>
 
 #include <sys/mman.h>
@@ -18,8 +19,41 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <fstream>
+#include <optional>
+#include <sstream>
+
 namespace ipcpp::shm {
 
+namespace {
+
+/// mount point of the first hugetlbfs with the systems default huge page size (e.g. /dev/hugepages)
+const std::optional<std::string>& hugetlbfs_mount_point() {
+  static const std::optional<std::string> mount_point = []() -> std::optional<std::string> {
+    std::ifstream mounts("/proc/mounts");
+    std::string line;
+    while (std::getline(mounts, line)) {
+      std::istringstream entry(line);
+      std::string device, path, type;
+      if (entry >> device >> path >> type && type == "hugetlbfs") {
+        return path;
+      }
+    }
+    return std::nullopt;
+  }();
+  return mount_point;
+}
+
+/// path of the shm object path on the hugetlbfs mount (path starts with '/')
+std::optional<std::string> hugetlbfs_path(const std::string& path) {
+  if (const auto& mount_point = hugetlbfs_mount_point(); mount_point.has_value()) {
+    return mount_point.value() + path;
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
 // _____________________________________________________________________________________________________________________
 shared_memory_file::~shared_memory_file() {
   if (_native_handle != 0) {
@@ -31,12 +65,45 @@ shared_memory_file::~shared_memory_file() {
 }
 
 // _____________________________________________________________________________________________________________________
-void shared_memory_file::unlink() const { shm_unlink(_path.c_str()); }
+void shared_memory_file::unlink() const {
+  if (_anonymous) {
+    return;
+  }
+  if (_huge_tlb) {
+    ::unlink(hugetlbfs_path(_path).value().c_str());
+  } else {
+    shm_unlink(_path.c_str());
+  }
+}
 
 // _____________________________________________________________________________________________________________________
 std::expected<shared_memory_file, std::error_code> shared_memory_file::create(std::string&& path,
-                                                                              std::size_t size) {
-  size = utils::align_up(size, getpagesize());
+                                                                              std::size_t size,
+                                                                              const bool huge_pages) {
+  if (huge_pages) {
+    if (auto huge_tlb_path = hugetlbfs_path(path); huge_tlb_path.has_value()) {
+      ::unlink(huge_tlb_path->c_str());
+      shm_unlink(path.c_str());
+      const std::size_t huge_size = utils::align_up(size, utils::PageSize::Huge);
+      const int fd = ::open(huge_tlb_path->c_str(), O_RDWR | O_CREAT | O_EXCL, 0666);
+      // ftruncate fails if not enough huge pages are reserved (vm.nr_hugepages)
+      if (fd != -1 && ftruncate(fd, static_cast<std::int64_t>(huge_size)) == 0) {
+        shared_memory_file self(std::move(path), huge_size);
+        self._access_mode = AccessMode::WRITE;
+        self._native_handle = fd;
+        self._was_created = true;
+        self._huge_tlb = true;
+        return self;
+      }
+      if (fd != -1) {
+        close(fd);
+        ::unlink(huge_tlb_path->c_str());
+      }
+    }
+    logging::warn("shared_memory_file::create('{}'): no huge pages available, using regular pages", path);
+  }
+
+  size = utils::align_up(size, utils::PageSize::Regular);
   shared_memory_file self(std::move(path), size);
   self._access_mode = AccessMode::WRITE;
 
@@ -61,7 +128,14 @@ std::expected<shared_memory_file, std::error_code> shared_memory_file::create(st
 std::expected<shared_memory_file, std::error_code> shared_memory_file::open(std::string&& path, const AccessMode access_mode) {
   const int o_flags = (access_mode == AccessMode::WRITE) ? O_RDWR : O_RDONLY;
 
-  const int fd = shm_open(path.c_str(), o_flags, 0666);
+  bool huge_tlb = false;
+  int fd = shm_open(path.c_str(), o_flags, 0666);
+  if (fd == -1 && errno == ENOENT) {
+    if (auto huge_tlb_path = hugetlbfs_path(path); huge_tlb_path.has_value()) {
+      fd = ::open(huge_tlb_path->c_str(), o_flags);
+      huge_tlb = fd != -1;
+    }
+  }
   if (fd == -1) {
     return std::unexpected(std::error_code(static_cast<int>(error_t::open_error), error_category()));
   }
@@ -73,8 +147,52 @@ std::expected<shared_memory_file, std::error_code> shared_memory_file::open(std:
 
   shared_memory_file self(std::move(path), shm_stat.st_size);
   self._access_mode = access_mode;
+  self._huge_tlb = huge_tlb;
+
+  self._native_handle = fd;
 
+  return self;
+}
+
+// _____________________________________________________________________________________________________________________
+std::expected<shared_memory_file, std::error_code> shared_memory_file::create_anonymous(std::string&& name,
+                                                                                        std::size_t size) {
+  size = utils::align_up(size, utils::PageSize::Regular);
+  const int fd = memfd_create(name.c_str(), MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fd == -1) {
+    return std::unexpected(std::error_code(static_cast<int>(error_t::creation_error), error_category()));
+  }
+  shared_memory_file self(std::move(name), size);
+  self._access_mode = AccessMode::WRITE;
   self._native_handle = fd;
+  self._anonymous = true;
+
+  if (ftruncate(fd, static_cast<std::int64_t>(size)) == -1) {
+    return std::unexpected(std::error_code(static_cast<int>(error_t::resize_error), error_category()));
+  }
+  if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) == -1) {
+    return std::unexpected(std::error_code(static_cast<int>(error_t::creation_error), error_category()));
+  }
+
+  return self;
+}
+
+// _____________________________________________________________________________________________________________________
+std::expected<shared_memory_file, std::error_code> shared_memory_file::from_native_handle(
+    std::string&& name, const native_handle_t handle, const AccessMode access_mode) {
+  shared_memory_file self(std::move(name), 0);
+  self._access_mode = access_mode;
+  self._native_handle = handle;
+  self._anonymous = true;
+
+  if (const int seals = fcntl(handle, F_GET_SEALS); seals == -1 || (seals & F_SEAL_SHRINK) == 0) {
+    return std::unexpected(std::error_code(static_cast<int>(error_t::open_error), error_category()));
+  }
+  struct stat shm_stat{};
+  if (fstat(handle, &shm_stat) == -1) {
+    return std::unexpected(std::error_code(static_cast<int>(error_t::open_error), error_category()));
+  }
+  self._size = shm_stat.st_size;
 
   return self;
 }
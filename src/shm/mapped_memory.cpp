@@ -79,7 +79,7 @@ std::size_t MappedMemory<MappingType::DOUBLE>::size() const {
 // _____________________________________________________________________________________________________________________
 template <>
 std::expected<MappedMemory<MappingType::SINGLE>, std::error_code> MappedMemory<MappingType::SINGLE>::open(
-    shared_memory_file&& shm_file, const AccessMode access_mode) {
+    shared_memory_file&& shm_file, const AccessMode access_mode, const MappingOptions& options) {
   if (shm_file.access_mode() == AccessMode::READ && access_mode == AccessMode::WRITE) {
     return std::unexpected(std::error_code(static_cast<int>(error_t::access_error), error_category()));
   }
@@ -93,26 +93,30 @@ std::expected<MappedMemory<MappingType::SINGLE>, std::error_code> MappedMemory<M
   } else {
     return std::unexpected(result.error());
   }
+  if (auto error = _advise_memory(self._mapped_region, self._size, access_mode, options, self._shm_file.is_huge_tlb());
+      error) {
+    return std::unexpected(error);
+  }
   return self;
 }
 
 // _____________________________________________________________________________________________________________________
 template <>
 std::expected<MappedMemory<MappingType::SINGLE>, std::error_code> MappedMemory<MappingType::SINGLE>::open(
-    std::string_view shm_id, const AccessMode access_mode) {
+    std::string_view shm_id, const AccessMode access_mode, const MappingOptions& options) {
   logging::debug("MappedMemory<MAPPING::SINGLE>::open(shm_id='{}', access_mode={})", std::string(shm_id),
                  static_cast<int>(access_mode));
   auto shm_result = shared_memory_file::open(std::string(shm_id), access_mode);
   if (!shm_result.has_value()) {
     return std::unexpected(shm_result.error());
   }
-  return open(std::move(shm_result.value()));
+  return open(std::move(shm_result.value()), access_mode, options);
 }
 
 // _____________________________________________________________________________________________________________________
 template <>
 std::expected<MappedMemory<MappingType::DOUBLE>, std::error_code> MappedMemory<MappingType::DOUBLE>::open(
-    shared_memory_file&& shm_file, const AccessMode access_mode) {
+    shared_memory_file&& shm_file, const AccessMode access_mode, const MappingOptions& options) {
   logging::debug("MappedMemory<MAPPING::DOUBLE>::open(shared_memory_file={}, access_mode={})", shm_file.name(),
                  static_cast<int>(access_mode));
   if (shm_file.access_mode() == AccessMode::READ && access_mode == AccessMode::WRITE) {
@@ -135,61 +139,68 @@ std::expected<MappedMemory<MappingType::DOUBLE>, std::error_code> MappedMemory<M
       !second_mapping.has_value()) {
     return std::unexpected(second_mapping.error());
   }
+  if (auto error =
+          _advise_memory(self._mapped_region, self._total_size, access_mode, options, self._shm_file.is_huge_tlb());
+      error) {
+    return std::unexpected(error);
+  }
   return self;
 }
 
 // _____________________________________________________________________________________________________________________
 template <>
 std::expected<MappedMemory<MappingType::DOUBLE>, std::error_code> MappedMemory<MappingType::DOUBLE>::open(
-    std::string_view shm_id, const AccessMode access_mode) {
+    std::string_view shm_id, const AccessMode access_mode, const MappingOptions& options) {
   logging::debug("MappedMemory<MAPPING::DOUBLE>::open(shm_id='{}', access_mode={})", shm_id,
                  static_cast<int>(access_mode));
   auto shm_result = shared_memory_file::open(std::string(shm_id), access_mode);
   if (!shm_result.has_value()) {
     return std::unexpected(shm_result.error());
   }
-  return open(std::move(shm_result.value()), access_mode);
+  return open(std::move(shm_result.value()), access_mode, options);
 }
 
 // ___ open_or_create __________________________________________________________________________________________________
 // _____________________________________________________________________________________________________________________
 template <>
 std::expected<MappedMemory<MappingType::SINGLE>, std::error_code> MappedMemory<MappingType::SINGLE>::create(
-    std::string_view shm_id, const std::size_t min_size) {
+    std::string_view shm_id, const std::size_t min_size, const MappingOptions& options) {
   logging::debug("MappedMemory<MAPPING::DOUBLE>::create(shm_id='{}', min_size={})", shm_id, min_size);
-  auto shm_result = shared_memory_file::create(std::string(shm_id), min_size);
+  auto shm_result =
+      shared_memory_file::create(std::string(shm_id), min_size, options.huge_pages == HugePages::Explicit);
   if (!shm_result.has_value()) {
     return std::unexpected(shm_result.error());
   }
-  return open(std::move(shm_result.value()), AccessMode::WRITE);
+  return open(std::move(shm_result.value()), AccessMode::WRITE, options);
 }
 
 // _____________________________________________________________________________________________________________________
 template <>
 std::expected<MappedMemory<MappingType::SINGLE>, std::error_code> MappedMemory<MappingType::SINGLE>::create(
-    shared_memory_file&& shm_file) {
+    shared_memory_file&& shm_file, const MappingOptions& options) {
   logging::debug("MappedMemory<MAPPING::DOUBLE>::create(shm_file='{}')", shm_file.name());
-  return open(std::move(shm_file), AccessMode::WRITE);
+  return open(std::move(shm_file), AccessMode::WRITE, options);
 }
 
 // _____________________________________________________________________________________________________________________
 template <>
 std::expected<MappedMemory<MappingType::DOUBLE>, std::error_code> MappedMemory<MappingType::DOUBLE>::create(
-    std::string_view shm_id, const std::size_t min_size) {
+    std::string_view shm_id, const std::size_t min_size, const MappingOptions& options) {
   logging::debug("MappedMemory<MAPPING::DOUBLE>::create(shm_id='{}', min_size={})", shm_id, min_size);
-  auto shm_result = shared_memory_file::create(std::string(shm_id), min_size);
+  auto shm_result =
+      shared_memory_file::create(std::string(shm_id), min_size, options.huge_pages == HugePages::Explicit);
   if (!shm_result.has_value()) {
     return std::unexpected(shm_result.error());
   }
-  return open(std::move(shm_result.value()), AccessMode::WRITE);
+  return open(std::move(shm_result.value()), AccessMode::WRITE, options);
 }
 
 // _____________________________________________________________________________________________________________________
 template <>
 std::expected<MappedMemory<MappingType::DOUBLE>, std::error_code> MappedMemory<MappingType::DOUBLE>::create(
-    shared_memory_file&& shm_file) {
+    shared_memory_file&& shm_file, const MappingOptions& options) {
   logging::debug("MappedMemory<MAPPING::DOUBLE>::create(shm_file='{}')", shm_file.name());
-  return open(std::move(shm_file), AccessMode::WRITE);
+  return open(std::move(shm_file), AccessMode::WRITE, options);
 }
 
 // ___ release _________________________________________________________________________________________________________
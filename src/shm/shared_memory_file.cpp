@@ -24,6 +24,8 @@ shared_memory_file::shared_memory_file(shared_memory_file&& other) noexcept {
   std::swap(_size, other._size);
   std::swap(_native_handle, other._native_handle);
   std::swap(_was_created, other._was_created);
+  std::swap(_huge_tlb, other._huge_tlb);
+  std::swap(_anonymous, other._anonymous);
 }
 
 // _____________________________________________________________________________________________________________________
@@ -40,6 +42,8 @@ shared_memory_file& shared_memory_file::operator=(shared_memory_file&& other) no
     std::swap(_size, other._size);
     std::swap(_native_handle, other._native_handle);
     std::swap(_was_created, other._was_created);
+    std::swap(_huge_tlb, other._huge_tlb);
+    std::swap(_anonymous, other._anonymous);
   }
   return *this;
 }
@@ -53,6 +57,9 @@ std::size_t shared_memory_file::size() const { return _size; }
 // _____________________________________________________________________________________________________________________
 AccessMode shared_memory_file::access_mode() const { return _access_mode; }
 
+// _____________________________________________________________________________________________________________________
+bool shared_memory_file::is_huge_tlb() const { return _huge_tlb; }
+
 // _____________________________________________________________________________________________________________________
 shared_memory_file::native_handle_t shared_memory_file::native_handle() const {
   return _native_handle;
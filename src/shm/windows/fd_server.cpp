@@ -0,0 +1,101 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <ipcpp/utils/platform.h>
+
+#ifdef IPCPP_WINDOWS
+
+#include <ipcpp/shm/fd_server.h>
+
+#include <windows.h>
+
+#include <string>
+
+namespace ipcpp::shm {
+
+// handles are shared by DuplicateHandle on windows: not supported yet
+struct FdServer::State {};
+
+// _____________________________________________________________________________________________________________________
+FdServer::FdServer(std::unique_ptr<State>&& state) : _state(std::move(state)) {}
+
+// _____________________________________________________________________________________________________________________
+FdServer::FdServer(FdServer&& other) noexcept = default;
+
+// _____________________________________________________________________________________________________________________
+FdServer& FdServer::operator=(FdServer&& other) noexcept = default;
+
+// _____________________________________________________________________________________________________________________
+FdServer::~FdServer() = default;
+
+// _____________________________________________________________________________________________________________________
+std::expected<FdServer, std::error_code> FdServer::create(std::string_view, native_handle_t) {
+  return std::unexpected(std::make_error_code(std::errc::not_supported));
+}
+
+// _____________________________________________________________________________________________________________________
+std::expected<FdServer, std::error_code> FdServer::standby(std::string_view, native_handle_t) {
+  return std::unexpected(std::make_error_code(std::errc::not_supported));
+}
+
+// _____________________________________________________________________________________________________________________
+std::expected<FdServer::native_handle_t, std::error_code> FdServer::receive(std::string_view,
+                                                                            std::chrono::milliseconds) {
+  return std::unexpected(std::make_error_code(std::errc::not_supported));
+}
+
+// _____________________________________________________________________________________________________________________
+bool FdServer::is_serving() const { return false; }
+
+// === NameLock ========================================================================================================
+struct NameLock::State {
+  HANDLE mutex = nullptr;
+
+  ~State() {
+    if (mutex != nullptr) {
+      ReleaseMutex(mutex);
+      CloseHandle(mutex);
+    }
+  }
+};
+
+// _____________________________________________________________________________________________________________________
+NameLock::NameLock(std::unique_ptr<State>&& state) : _state(std::move(state)) {}
+
+// _____________________________________________________________________________________________________________________
+NameLock::NameLock(NameLock&& other) noexcept = default;
+
+// _____________________________________________________________________________________________________________________
+NameLock& NameLock::operator=(NameLock&& other) noexcept = default;
+
+// _____________________________________________________________________________________________________________________
+NameLock::~NameLock() = default;
+
+// _____________________________________________________________________________________________________________________
+std::expected<NameLock, std::error_code> NameLock::acquire(const std::string_view name,
+                                                           const std::chrono::milliseconds timeout) {
+  const HANDLE mutex = CreateMutexA(nullptr, FALSE, std::string(name).c_str());
+  if (mutex == nullptr) {
+    return std::unexpected(std::error_code(static_cast<int>(GetLastError()), std::system_category()));
+  }
+  // WAIT_ABANDONED: the previous holder exited without releasing the mutex, we own it now
+  if (const DWORD rc = WaitForSingleObject(mutex, static_cast<DWORD>(timeout.count()));
+      rc != WAIT_OBJECT_0 && rc != WAIT_ABANDONED) {
+    CloseHandle(mutex);
+    if (rc == WAIT_TIMEOUT) {
+      return std::unexpected(std::make_error_code(std::errc::timed_out));
+    }
+    return std::unexpected(std::error_code(static_cast<int>(GetLastError()), std::system_category()));
+  }
+  auto state = std::make_unique<State>();
+  state->mutex = mutex;
+  return NameLock(std::move(state));
+}
+
+}  // namespace ipcpp::shm
+
+#endif
@@ -58,6 +58,23 @@ std::expected<std::uintptr_t, std::error_code> _map_memory(const std::size_t exp
   return reinterpret_cast<std::uintptr_t>(mapped_region);
 }
 
+// === private definition: advise_memory: windows implementation =======================================================
+// _____________________________________________________________________________________________________________________
+std::error_code _advise_memory(const std::uintptr_t addr, const std::size_t size, const AccessMode access_mode,
+                               const MappingOptions& options, bool) {
+  // large pages require SEC_LARGE_PAGES at creation (and SeLockMemoryPrivilege): not supported on windows yet
+  // numa placement requires MapViewOfFileExNuma: not supported on windows yet, first touch applies
+  if (options.populate) {
+    WIN32_MEMORY_RANGE_ENTRY range{reinterpret_cast<void*>(addr), size};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+  }
+  // VirtualLock locks (and faults in) the pages, there is no on-fault variant
+  if (options.lock != MemoryLock::None && !VirtualLock(reinterpret_cast<void*>(addr), size)) {
+    return {static_cast<int>(error_t::lock_error), error_category()};
+  }
+  return {};
+}
+
 // === member function definitions: platform specific implementation ===================================================
 // ___ msync ___________________________________________________________________________________________________________
 // _____________________________________________________________________________________________________________________
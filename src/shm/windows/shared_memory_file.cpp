@@ -26,7 +26,9 @@ void shared_memory_file::unlink() const {}
 
 // _____________________________________________________________________________________________________________________
 std::expected<shared_memory_file, std::error_code> shared_memory_file::create(std::string&& path,
-                                                                              const std::size_t size) {
+                                                                              const std::size_t size,
+                                                                              [[maybe_unused]] const bool huge_pages) {
+  // SEC_LARGE_PAGES requires SeLockMemoryPrivilege: regular pages are used on windows
   shared_memory_file self(std::move(path), size);
   self._access_mode = AccessMode::WRITE;
 
@@ -80,6 +82,19 @@ std::expected<shared_memory_file, std::error_code> shared_memory_file::open(std:
   return self;
 }
 
+// _____________________________________________________________________________________________________________________
+std::expected<shared_memory_file, std::error_code> shared_memory_file::create_anonymous(std::string&&, std::size_t) {
+  // anonymous file mappings can only be shared by DuplicateHandle: not supported on windows yet
+  return std::unexpected(std::make_error_code(std::errc::not_supported));
+}
+
+// _____________________________________________________________________________________________________________________
+std::expected<shared_memory_file, std::error_code> shared_memory_file::from_native_handle(std::string&&,
+                                                                                          native_handle_t,
+                                                                                          AccessMode) {
+  return std::unexpected(std::make_error_code(std::errc::not_supported));
+}
+
 }
 
 #endif
\ No newline at end of file
@@ -11,59 +11,155 @@
 
 #include <filesystem>
 #include <format>
+#include <thread>
 
 namespace ipcpp {
 
-std::unordered_map<std::string, std::shared_ptr<ShmRegistryEntry>> ShmRegistry::_shm_registry{};
-std::mutex ShmRegistry::_mutex{};
+std::array<ShmRegistry::Bucket, ShmRegistry::num_buckets> ShmRegistry::_buckets{};
 
 // === TopicRegistry ===================================================================================================
 // _____________________________________________________________________________________________________________________
-std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> ShmRegistry::get_shm_entry(const std::string& id, std::size_t min_shm_size) {
-  std::unique_lock lock(ShmRegistry::_mutex);
-  auto e_entry = open_shm(id);
-  if (e_entry.has_value()) {
-    return e_entry;
-  } else {
-    return create_shm(id, min_shm_size);
+std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> ShmRegistry::get_shm_entry(
+    const std::string& id, std::size_t min_shm_size, const shm::MappingOptions& options) {
+  Bucket& bucket = bucket_of(id);
+  if (auto entry = find_entry(bucket, id); entry) {
+    return entry;
   }
+  std::unique_lock lock(bucket.mutex);
+  // another thread may have created it while we waited for the lock
+  if (auto entry = find_entry(bucket, id); entry) {
+    return entry;
+  }
+  auto e_mm = open_or_create_shm(id, min_shm_size, options);
+  if (!e_mm.has_value()) {
+    return std::unexpected(e_mm.error());
+  }
+  return insert_entry(bucket, ShmRegistryEntry(id, std::move(*e_mm)));
 }
 
 // _____________________________________________________________________________________________________________________
-std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> ShmRegistry::open_shm(const std::string& id) {
-  auto it = ShmRegistry::_shm_registry.find(id);
-  if (it != ShmRegistry::_shm_registry.end()) {
-    return it->second;
+std::expected<shm::MappedMemory<shm::MappingType::SINGLE>, std::error_code> ShmRegistry::open_or_create_shm(
+    const std::string& id, std::size_t min_shm_size, const shm::MappingOptions& options) {
+  // held across open and create: two processes never both create (and unlink each others) shm object
+  auto e_lock = shm::NameLock::acquire(std::format("ipcpp/{}.lock", id));
+  if (!e_lock.has_value()) {
+    return std::unexpected(e_lock.error());
   }
-  file_lock lock("global");
-  lock.lock();
-  auto e_mm = shm::MappedMemory<shm::MappingType::SINGLE>::open(ShmRegistryEntry::shm_name(id));
-  lock.unlock();
+  auto e_mm = shm::MappedMemory<shm::MappingType::SINGLE>::open(ShmRegistryEntry::shm_name(id), AccessMode::WRITE,
+                                                                options);
   if (!e_mm.has_value()) {
-    return std::unexpected(e_mm.error());
+    e_mm = shm::MappedMemory<shm::MappingType::SINGLE>::create(ShmRegistryEntry::shm_name(id), min_shm_size, options);
   }
-  auto topic = std::make_shared<ShmRegistryEntry>(ShmRegistryEntry(id, std::move(*e_mm)));
-  ShmRegistry::_shm_registry[id] = topic;
-  return topic;
+  return e_mm;
+}
+
+// _____________________________________________________________________________________________________________________
+ShmRegistry::Bucket& ShmRegistry::bucket_of(const std::string_view id) {
+  return _buckets[std::hash<std::string_view>()(id) % num_buckets];
 }
 
 // _____________________________________________________________________________________________________________________
-std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> ShmRegistry::create_shm(const std::string& id,
-                                                                                          std::size_t min_shm_size) {
-  auto it = ShmRegistry::_shm_registry.find(id);
-  if (it != ShmRegistry::_shm_registry.end()) {
-    return std::unexpected(std::error_code(1, std::system_category()));
+std::shared_ptr<ShmRegistryEntry> ShmRegistry::find_entry(const Bucket& bucket, const std::string_view id) {
+  for (const Node* node = bucket.head.load(std::memory_order_acquire); node != nullptr; node = node->next) {
+    if (node->id == id) {
+      return node->entry;
+    }
   }
-  file_lock lock("global");
-  lock.lock();
-  auto e_mm = shm::MappedMemory<shm::MappingType::SINGLE>::create(ShmRegistryEntry::shm_name(id), min_shm_size);
-  lock.unlock();
-  if (!e_mm.has_value()) {
-    return std::unexpected(e_mm.error());
+  return nullptr;
+}
+
+// _____________________________________________________________________________________________________________________
+std::shared_ptr<ShmRegistryEntry> ShmRegistry::insert_entry(Bucket& bucket, ShmRegistryEntry&& entry) {
+  auto* node = new Node{entry.id(), std::make_shared<ShmRegistryEntry>(std::move(entry)),
+                        bucket.head.load(std::memory_order_relaxed)};
+  // node is fully constructed before readers can reach it
+  bucket.head.store(node, std::memory_order_release);
+  return node->entry;
+}
+
+// _____________________________________________________________________________________________________________________
+ShmRegistry::Bucket::~Bucket() {
+  // entries are released at exit: created shm objects are unlinked
+  for (const Node* node = head.load(std::memory_order_acquire); node != nullptr;) {
+    const Node* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+// _____________________________________________________________________________________________________________________
+std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> ShmRegistry::get_memfd_entry(
+    const std::string& id, std::size_t min_shm_size, const shm::MappingOptions& options) {
+  Bucket& bucket = bucket_of(id);
+  if (auto entry = find_entry(bucket, id); entry) {
+    return entry;
+  }
+  std::unique_lock lock(bucket.mutex);
+  if (auto entry = find_entry(bucket, id); entry) {
+    return entry;
   }
-  auto topic = std::make_shared<ShmRegistryEntry>(ShmRegistryEntry(id, std::move(*e_mm)));
-  ShmRegistry::_shm_registry[id] = topic;
-  return topic;
+  const std::string name = ShmRegistryEntry::memfd_name(id);
+  // held across receive and create: two processes never both create an object for id. Standby servers take over
+  //  without the lock, they only need the name.
+  auto e_lock = shm::NameLock::acquire(std::format("ipcpp/{}.memfd.lock", id));
+  if (!e_lock.has_value()) {
+    return std::unexpected(e_lock.error());
+  }
+  // a few attempts: the serving process may exit while we connect
+  std::error_code error = std::make_error_code(std::errc::connection_refused);
+  for (int attempt = 0; attempt < 3; ++attempt) {
+    auto e_handle = shm::FdServer::receive(name);
+    if (!e_handle.has_value() && e_handle.error() == std::errc::connection_refused) {
+      // nobody serves name: either there is no holder or the serving process just exited and a standby server of
+      //  another holder is about to take over
+      std::this_thread::sleep_for(2 * shm::FdServer::takeover_interval);
+      e_handle = shm::FdServer::receive(name);
+    }
+    if (e_handle.has_value()) {
+      const auto handle = e_handle.value();
+      auto e_file = shm::shared_memory_file::from_native_handle(std::string(id), handle);
+      if (!e_file.has_value()) {
+        return std::unexpected(e_file.error());
+      }
+      auto e_mm = shm::MappedMemory<shm::MappingType::SINGLE>::open(std::move(*e_file), AccessMode::WRITE, options);
+      if (!e_mm.has_value()) {
+        return std::unexpected(e_mm.error());
+      }
+      auto e_server = shm::FdServer::standby(name, handle);
+      if (!e_server.has_value()) {
+        return std::unexpected(e_server.error());
+      }
+      return insert_entry(bucket, ShmRegistryEntry(id, std::move(*e_mm), std::move(*e_server)));
+    }
+    error = e_handle.error();
+    if (error != std::errc::connection_refused) {
+      continue;
+    }
+    if (min_shm_size == 0) {
+      return std::unexpected(error);
+    }
+    auto e_file = shm::shared_memory_file::create_anonymous(std::string(id), min_shm_size);
+    if (!e_file.has_value()) {
+      return std::unexpected(e_file.error());
+    }
+    const auto handle = e_file->native_handle();
+    // mapped (and advised) before it is served: peers never map an object whose placement is not applied yet
+    auto e_mm = shm::MappedMemory<shm::MappingType::SINGLE>::create(std::move(*e_file), options);
+    if (!e_mm.has_value()) {
+      return std::unexpected(e_mm.error());
+    }
+    // fails if a standby server took over later than takeover_interval: join the object it serves
+    auto e_server = shm::FdServer::create(name, handle);
+    if (!e_server.has_value()) {
+      error = e_server.error();
+      if (error == std::errc::address_in_use) {
+        continue;
+      }
+      return std::unexpected(error);
+    }
+    return insert_entry(bucket, ShmRegistryEntry(id, std::move(*e_mm), std::move(*e_server)));
+  }
+  return std::unexpected(error);
 }
 
 // === TopicEntry ===========================================================================================================
@@ -80,6 +176,9 @@ std::string ShmRegistryEntry::shm_name(std::string_view id) {
 #endif
 }
 
+// _____________________________________________________________________________________________________________________
+std::string ShmRegistryEntry::memfd_name(std::string_view id) { return std::format("ipcpp/{}.memfd", id); }
+
 // _____________________________________________________________________________________________________________________
 const std::string& ShmRegistryEntry::id() const { return _id; }
 
@@ -89,8 +188,16 @@ bool ShmRegistryEntry::operator==(const ipcpp::ShmRegistryEntry& other) const {
 }
 
 std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> get_shm_entry(const std::string& id,
-                                                                          std::size_t min_shm_size) {
-  return ShmRegistry::get_shm_entry(id, min_shm_size);
+                                                                                std::size_t min_shm_size,
+                                                                                const shm::MappingOptions& options) {
+  return ShmRegistry::get_shm_entry(id, min_shm_size, options);
+}
+
+// _____________________________________________________________________________________________________________________
+std::expected<std::shared_ptr<ShmRegistryEntry>, std::error_code> get_memfd_entry(const std::string& id,
+                                                                                  std::size_t min_shm_size,
+                                                                                  const shm::MappingOptions& options) {
+  return ShmRegistry::get_memfd_entry(id, min_shm_size, options);
 }
 
-}  // namespace ipcpp
\ No newline at end of file
+}  // namespace ipcpp
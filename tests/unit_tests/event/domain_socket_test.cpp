@@ -0,0 +1,100 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/event/domain_socket_notifier.h>
+#include <ipcpp/event/domain_socket_observer.h>
+
+#include <chrono>
+
+using ipcpp::event::DomainSocketNotifier;
+using ipcpp::event::DomainSocketObserver;
+using ipcpp::event::notifier::BatchOptions;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+std::expected<int, std::error_code> receive(DomainSocketObserver<int>& observer,
+                                           const std::chrono::milliseconds timeout) {
+  return observer.receive(timeout, [](const int notification) { return notification; });
+}
+
+}  // namespace
+
+TEST(ipcpp_domain_socket, batch_flushed_by_size) {
+  auto notifier = DomainSocketNotifier<int>::create("ipcpp_test_domain_socket_size", 8,
+                                                    {.max_batch_size = 4, .max_batch_delay = 10s});
+  ASSERT_TRUE(notifier.has_value());
+  notifier->accept_subscriptions();
+  auto observer = DomainSocketObserver<int>::create("ipcpp_test_domain_socket_size", 4);
+  ASSERT_TRUE(observer.has_value());
+  ASSERT_FALSE(observer->subscribe());
+
+  for (int i = 1; i <= 3; ++i) {
+    notifier->notify_observers(i);
+  }
+  // an incomplete batch is held back
+  EXPECT_FALSE(receive(observer.value(), 50ms).has_value());
+
+  notifier->notify_observers(4);
+  // the whole batch arrives with one recv and is handed out in order
+  auto first = receive(observer.value(), 1000ms);
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(first.value(), 1);
+  EXPECT_EQ(observer->num_buffered_notifications(), 3);
+  for (int i = 2; i <= 4; ++i) {
+    auto notification = receive(observer.value(), 1000ms);
+    ASSERT_TRUE(notification.has_value());
+    EXPECT_EQ(notification.value(), i);
+  }
+  EXPECT_EQ(observer->num_buffered_notifications(), 0);
+}
+
+TEST(ipcpp_domain_socket, batch_flushed_by_deadline) {
+  auto notifier = DomainSocketNotifier<int>::create("ipcpp_test_domain_socket_deadline", 8,
+                                                    {.max_batch_size = 100, .max_batch_delay = 20ms});
+  ASSERT_TRUE(notifier.has_value());
+  notifier->accept_subscriptions();
+  auto observer = DomainSocketObserver<int>::create("ipcpp_test_domain_socket_deadline", 100);
+  ASSERT_TRUE(observer.has_value());
+  ASSERT_FALSE(observer->subscribe());
+
+  const auto start = std::chrono::steady_clock::now();
+  notifier->notify_observers(1);
+  notifier->notify_observers(2);
+  auto first = receive(observer.value(), 1000ms);
+  ASSERT_TRUE(first.has_value());
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+  EXPECT_EQ(first.value(), 1);
+  auto second = receive(observer.value(), 1000ms);
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(second.value(), 2);
+}
+
+TEST(ipcpp_domain_socket, move_with_pending_batch) {
+  auto notifier = DomainSocketNotifier<int>::create("ipcpp_test_domain_socket_move", 8,
+                                                    {.max_batch_size = 4, .max_batch_delay = 10s});
+  ASSERT_TRUE(notifier.has_value());
+  notifier->accept_subscriptions();
+  auto observer = DomainSocketObserver<int>::create("ipcpp_test_domain_socket_move", 4);
+  ASSERT_TRUE(observer.has_value());
+  ASSERT_FALSE(observer->subscribe());
+
+  notifier->notify_observers(1);
+  notifier->notify_observers(2);
+  // the pending batch and the subscribed observers move along
+  DomainSocketNotifier<int> moved(std::move(notifier.value()));
+  EXPECT_EQ(moved.num_observers(), 1);
+  moved.notify_observers(3);
+  moved.notify_observers(4);
+  for (int i = 1; i <= 4; ++i) {
+    auto notification = receive(observer.value(), 1000ms);
+    ASSERT_TRUE(notification.has_value());
+    EXPECT_EQ(notification.value(), i);
+  }
+}
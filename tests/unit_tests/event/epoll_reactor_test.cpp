@@ -0,0 +1,215 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/event/domain_socket_observer.h>
+#include <ipcpp/event/epoll_domain_socket_notifier.h>
+#include <ipcpp/event/epoll_reactor.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+
+using ipcpp::event::DomainSocketObserver;
+using ipcpp::event::EpollDomainSocketNotifier;
+using ipcpp::event::EpollReactor;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/// handlers run asynchronously on the reactor thread
+bool wait_until(const std::function<bool()>& predicate, const std::chrono::milliseconds timeout = 5s) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (!predicate()) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(1ms);
+  }
+  return true;
+}
+
+void signal(const int event_fd) {
+  const std::uint64_t one = 1;
+  ASSERT_EQ(write(event_fd, &one, sizeof(one)), sizeof(one));
+}
+
+std::expected<int, std::error_code> receive(DomainSocketObserver<int>& observer,
+                                           const std::chrono::milliseconds timeout) {
+  return observer.receive(timeout, [](const int notification) { return notification; });
+}
+
+}  // namespace
+
+TEST(ipcpp_epoll_reactor, add_remove) {
+  auto reactor = EpollReactor::create();
+  ASSERT_TRUE(reactor.has_value());
+  const int event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  ASSERT_NE(event_fd, -1);
+
+  std::atomic_int num_calls = 0;
+  ASSERT_FALSE(reactor.value()->add(event_fd, EPOLLIN, [event_fd, &num_calls](std::uint32_t events) {
+    std::uint64_t value = 0;
+    if ((events & EPOLLIN) && read(event_fd, &value, sizeof(value)) == sizeof(value)) {
+      num_calls.fetch_add(1);
+    }
+  }));
+  // an fd can only be registered once
+  EXPECT_TRUE(reactor.value()->add(event_fd, EPOLLIN, [](std::uint32_t) {}));
+
+  signal(event_fd);
+  ASSERT_TRUE(wait_until([&]() { return num_calls.load() == 1; }));
+  signal(event_fd);
+  ASSERT_TRUE(wait_until([&]() { return num_calls.load() == 2; }));
+
+  reactor.value()->remove(event_fd);
+  signal(event_fd);
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(num_calls.load(), 2);
+  // removing an fd twice is a no-op
+  reactor.value()->remove(event_fd);
+  close(event_fd);
+}
+
+TEST(ipcpp_epoll_reactor, remove_running_handler) {
+  auto reactor = EpollReactor::create();
+  ASSERT_TRUE(reactor.has_value());
+  const int event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  ASSERT_NE(event_fd, -1);
+
+  std::atomic_bool started = false;
+  std::atomic_bool completed = false;
+  auto guard = std::make_shared<int>(0);
+  ASSERT_FALSE(reactor.value()->add(event_fd, EPOLLIN, [guard, &started, &completed](std::uint32_t) {
+    started.store(true);
+    std::this_thread::sleep_for(50ms);
+    ++*guard;
+    completed.store(true);
+  }));
+  signal(event_fd);
+  ASSERT_TRUE(wait_until([&]() { return started.load(); }));
+  // the running handler keeps its captures alive until it returns
+  reactor.value()->remove(event_fd);
+  ASSERT_TRUE(wait_until([&]() { return completed.load(); }));
+  EXPECT_EQ(*guard, 1);
+  EXPECT_TRUE(wait_until([&]() { return guard.use_count() == 1; }));
+  close(event_fd);
+}
+
+TEST(ipcpp_epoll_reactor, shutdown) {
+  auto shared = EpollReactor::shared();
+  ASSERT_TRUE(shared.has_value());
+  auto same = EpollReactor::shared();
+  ASSERT_TRUE(same.has_value());
+  EXPECT_EQ(shared.value(), same.value());
+
+  auto reactor = EpollReactor::create();
+  ASSERT_TRUE(reactor.has_value());
+  EXPECT_NE(reactor.value(), shared.value());
+  const int event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  ASSERT_NE(event_fd, -1);
+  auto guard = std::make_shared<int>(0);
+  ASSERT_FALSE(reactor.value()->add(event_fd, EPOLLIN, [guard](std::uint32_t) {}));
+  EXPECT_EQ(guard.use_count(), 2);
+
+  // the destructor wakes up and joins the reactor thread although fds are still registered
+  const auto start = std::chrono::steady_clock::now();
+  reactor.value().reset();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+  EXPECT_EQ(guard.use_count(), 1);
+  close(event_fd);
+}
+
+TEST(ipcpp_epoll_domain_socket, notify_observers) {
+  auto reactor = EpollReactor::create();
+  ASSERT_TRUE(reactor.has_value());
+  auto notifier = EpollDomainSocketNotifier<int>::create("ipcpp_test_epoll_domain_socket", 2, 64, reactor.value());
+  ASSERT_TRUE(notifier.has_value());
+  notifier->accept_subscriptions();
+
+  auto observer = DomainSocketObserver<int>::create("ipcpp_test_epoll_domain_socket");
+  ASSERT_TRUE(observer.has_value());
+  ASSERT_FALSE(observer->subscribe());
+  auto second = DomainSocketObserver<int>::create("ipcpp_test_epoll_domain_socket");
+  ASSERT_TRUE(second.has_value());
+  ASSERT_FALSE(second->subscribe());
+  ASSERT_TRUE(wait_until([&]() { return notifier->num_observers() == 2; }));
+
+  for (int i = 1; i <= 3; ++i) {
+    notifier->notify_observers(i);
+  }
+  for (int i = 1; i <= 3; ++i) {
+    EXPECT_EQ(receive(observer.value(), 1000ms), i);
+    EXPECT_EQ(receive(second.value(), 1000ms), i);
+  }
+
+  // a cancelled observer is removed by the reactor, the other one still receives notifications
+  EXPECT_FALSE(second->cancel_subscription());
+  ASSERT_TRUE(wait_until([&]() { return notifier->num_observers() == 1; }));
+  notifier->notify_observers(4);
+  EXPECT_EQ(receive(observer.value(), 1000ms), 4);
+}
+
+TEST(ipcpp_epoll_domain_socket, notifier_destroyed_before_reactor) {
+  auto reactor = EpollReactor::create();
+  ASSERT_TRUE(reactor.has_value());
+  auto observer = DomainSocketObserver<int>::create("ipcpp_test_epoll_domain_socket_lifetime");
+  ASSERT_TRUE(observer.has_value());
+  {
+    auto notifier =
+        EpollDomainSocketNotifier<int>::create("ipcpp_test_epoll_domain_socket_lifetime", 1, 64, reactor.value());
+    ASSERT_TRUE(notifier.has_value());
+    notifier->accept_subscriptions();
+    ASSERT_FALSE(observer->subscribe());
+    ASSERT_TRUE(wait_until([&]() { return notifier->num_observers() == 1; }));
+    notifier->notify_observers(1);
+  }
+  EXPECT_EQ(receive(observer.value(), 1000ms), 1);
+  // the connection was closed by the notifier, no handler of the destroyed notifier runs anymore
+  EXPECT_FALSE(receive(observer.value(), 1000ms).has_value());
+  static_cast<void>(observer->cancel_subscription());
+
+  // the reactor keeps serving notifiers created later
+  auto notifier =
+      EpollDomainSocketNotifier<int>::create("ipcpp_test_epoll_domain_socket_lifetime", 1, 64, reactor.value());
+  ASSERT_TRUE(notifier.has_value());
+  notifier->accept_subscriptions();
+  auto late = DomainSocketObserver<int>::create("ipcpp_test_epoll_domain_socket_lifetime");
+  ASSERT_TRUE(late.has_value());
+  ASSERT_FALSE(late->subscribe());
+  ASSERT_TRUE(wait_until([&]() { return notifier->num_observers() == 1; }));
+  notifier->notify_observers(2);
+  EXPECT_EQ(receive(late.value(), 1000ms), 2);
+}
+
+TEST(ipcpp_epoll_domain_socket, reactor_outlives_last_handle) {
+  std::optional<EpollDomainSocketNotifier<int>> notifier;
+  {
+    auto reactor = EpollReactor::create();
+    ASSERT_TRUE(reactor.has_value());
+    auto e_notifier = EpollDomainSocketNotifier<int>::create("ipcpp_test_epoll_domain_socket_owner", 1, 64,
+                                                             std::move(reactor.value()));
+    ASSERT_TRUE(e_notifier.has_value());
+    notifier.emplace(std::move(e_notifier.value()));
+  }
+  // the notifier owns the dedicated reactor
+  notifier->accept_subscriptions();
+  auto observer = DomainSocketObserver<int>::create("ipcpp_test_epoll_domain_socket_owner");
+  ASSERT_TRUE(observer.has_value());
+  ASSERT_FALSE(observer->subscribe());
+  ASSERT_TRUE(wait_until([&]() { return notifier->num_observers() == 1; }));
+  notifier->notify_observers(7);
+  EXPECT_EQ(receive(observer.value(), 1000ms), 7);
+  notifier.reset();
+  EXPECT_FALSE(receive(observer.value(), 1000ms).has_value());
+}
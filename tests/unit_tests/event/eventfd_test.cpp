@@ -0,0 +1,173 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/event/eventfd_notifier.h>
+#include <ipcpp/event/eventfd_observer.h>
+#include <poll.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+using ipcpp::event::error_t;
+using ipcpp::event::EventFdNotifier;
+using ipcpp::event::EventFdObserver;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+std::expected<std::uint64_t, std::error_code> receive(EventFdObserver& observer,
+                                                     const std::chrono::milliseconds timeout) {
+  return observer.receive(timeout, [](const std::uint64_t value) { return value; });
+}
+
+/// subscriptions and observer requests are processed asynchronously by the reactor thread
+bool wait_until(const std::function<bool()>& predicate, const std::chrono::milliseconds timeout = 5s) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (!predicate()) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(1ms);
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(ipcpp_eventfd, subscribe) {
+  auto notifier = EventFdNotifier::create("ipcpp_test_eventfd_subscribe", 1);
+  ASSERT_TRUE(notifier.has_value());
+  notifier->accept_subscriptions();
+
+  auto observer = EventFdObserver::create("ipcpp_test_eventfd_subscribe");
+  ASSERT_TRUE(observer.has_value());
+  EXPECT_EQ(observer->native_handle(), -1);
+  EXPECT_EQ(receive(observer.value(), 10ms).error().value(), static_cast<int>(error_t::not_subscribed));
+  ASSERT_FALSE(observer->subscribe());
+  EXPECT_TRUE(observer->is_subscribed());
+  // the eventfd was passed by the notifier
+  EXPECT_NE(observer->native_handle(), -1);
+  EXPECT_EQ(notifier->num_observers(), 1);
+
+  // max_num_observers is exceeded
+  auto rejected = EventFdObserver::create("ipcpp_test_eventfd_subscribe");
+  ASSERT_TRUE(rejected.has_value());
+  EXPECT_EQ(rejected->subscribe().value(), static_cast<int>(error_t::subscription_failed));
+  EXPECT_FALSE(rejected->is_subscribed());
+
+  auto unknown = EventFdObserver::create("ipcpp_test_eventfd_unknown");
+  ASSERT_TRUE(unknown.has_value());
+  EXPECT_EQ(unknown->subscribe().value(), static_cast<int>(error_t::notifier_down));
+}
+
+TEST(ipcpp_eventfd, coalesced_notifications) {
+  auto notifier = EventFdNotifier::create("ipcpp_test_eventfd_coalesce");
+  ASSERT_TRUE(notifier.has_value());
+  notifier->accept_subscriptions();
+  auto observer = EventFdObserver::create("ipcpp_test_eventfd_coalesce");
+  ASSERT_TRUE(observer.has_value());
+  ASSERT_FALSE(observer->subscribe());
+
+  EXPECT_EQ(receive(observer.value(), 10ms).error().value(), static_cast<int>(error_t::timeout));
+
+  notifier->notify_observers();
+  notifier->notify_observers(2);
+  notifier->notify_observers();
+  // the eventfd can be multiplexed with poll
+  pollfd fd{.fd = observer->native_handle(), .events = POLLIN, .revents = 0};
+  ASSERT_EQ(poll(&fd, 1, 1000), 1);
+  EXPECT_EQ(receive(observer.value(), 100ms), 4);
+  EXPECT_EQ(receive(observer.value(), 10ms).error().value(), static_cast<int>(error_t::timeout));
+
+  // a blocked observer is woken up
+  std::thread delayed([&]() {
+    std::this_thread::sleep_for(20ms);
+    notifier->notify_observers(3);
+  });
+  EXPECT_EQ(receive(observer.value(), 5000ms), 3);
+  delayed.join();
+}
+
+TEST(ipcpp_eventfd, pause_resume) {
+  auto notifier = EventFdNotifier::create("ipcpp_test_eventfd_pause");
+  ASSERT_TRUE(notifier.has_value());
+  notifier->accept_subscriptions();
+  auto observer = EventFdObserver::create("ipcpp_test_eventfd_pause");
+  ASSERT_TRUE(observer.has_value());
+  ASSERT_FALSE(observer->subscribe());
+
+  ASSERT_TRUE(observer->pause_subscription().has_value());
+  EXPECT_TRUE(observer->is_subscription_paused());
+  EXPECT_EQ(receive(observer.value(), 10ms).error().value(), static_cast<int>(error_t::subscription_paused));
+  // give the reactor time to process the request: notifications are dropped while paused
+  std::this_thread::sleep_for(50ms);
+  notifier->notify_observers(5);
+
+  ASSERT_TRUE(observer->resume_subscription().has_value());
+  EXPECT_FALSE(observer->is_subscription_paused());
+  std::this_thread::sleep_for(50ms);
+  EXPECT_EQ(receive(observer.value(), 10ms).error().value(), static_cast<int>(error_t::timeout));
+  notifier->notify_observers(1);
+  EXPECT_EQ(receive(observer.value(), 1000ms), 1);
+}
+
+TEST(ipcpp_eventfd, cancel_subscription) {
+  auto notifier = EventFdNotifier::create("ipcpp_test_eventfd_cancel");
+  ASSERT_TRUE(notifier.has_value());
+  notifier->accept_subscriptions();
+  auto observer = EventFdObserver::create("ipcpp_test_eventfd_cancel");
+  ASSERT_TRUE(observer.has_value());
+  ASSERT_FALSE(observer->subscribe());
+  ASSERT_TRUE(wait_until([&]() { return notifier->num_observers() == 1; }));
+
+  EXPECT_FALSE(observer->cancel_subscription());
+  EXPECT_FALSE(observer->is_subscribed());
+  EXPECT_EQ(observer->native_handle(), -1);
+  EXPECT_TRUE(wait_until([&]() { return notifier->num_observers() == 0; }));
+  EXPECT_EQ(observer->cancel_subscription().value(), static_cast<int>(error_t::not_subscribed));
+  EXPECT_EQ(receive(observer.value(), 10ms).error().value(), static_cast<int>(error_t::not_subscribed));
+
+  // an observer can subscribe again
+  ASSERT_FALSE(observer->subscribe());
+  EXPECT_TRUE(wait_until([&]() { return notifier->num_observers() == 1; }));
+  notifier->notify_observers();
+  EXPECT_EQ(receive(observer.value(), 1000ms), 1);
+}
+
+TEST(ipcpp_eventfd, notifier_down) {
+  auto notifier = EventFdNotifier::create("ipcpp_test_eventfd_down");
+  ASSERT_TRUE(notifier.has_value());
+  notifier->accept_subscriptions();
+  auto observer = EventFdObserver::create("ipcpp_test_eventfd_down");
+  ASSERT_TRUE(observer.has_value());
+  ASSERT_FALSE(observer->subscribe());
+
+  notifier->notify_observers(2);
+  notifier->shutdown();
+  // pending notifications are still received
+  EXPECT_EQ(receive(observer.value(), 1000ms), 2);
+  EXPECT_EQ(receive(observer.value(), 1000ms).error().value(), static_cast<int>(error_t::notifier_down));
+
+  // a blocked observer detects the shutdown as well
+  auto restarted = EventFdNotifier::create("ipcpp_test_eventfd_down");
+  ASSERT_TRUE(restarted.has_value());
+  restarted->accept_subscriptions();
+  auto blocked = EventFdObserver::create("ipcpp_test_eventfd_down");
+  ASSERT_TRUE(blocked.has_value());
+  ASSERT_FALSE(blocked->subscribe());
+  ASSERT_TRUE(wait_until([&]() { return restarted->num_observers() == 1; }));
+  std::thread delayed([&]() {
+    std::this_thread::sleep_for(20ms);
+    restarted->shutdown();
+  });
+  EXPECT_EQ(receive(blocked.value(), 5000ms).error().value(), static_cast<int>(error_t::notifier_down));
+  delayed.join();
+}
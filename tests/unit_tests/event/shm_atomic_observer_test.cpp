@@ -0,0 +1,154 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/event/shm_atomic_notifier.h>
+#include <ipcpp/event/shm_atomic_observer.h>
+#include <ipcpp/event/shm_subscription_table.h>
+#include <ipcpp/event/wait_policy.h>
+#include <ipcpp/publish_subscribe/options.h>
+#include <ipcpp/utils/system.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/// pid of a process that has exited and was reaped
+std::uint64_t dead_pid() {
+  const pid_t pid = fork();
+  if (pid == 0) {
+    _exit(0);
+  }
+  waitpid(pid, nullptr, 0);
+  return static_cast<std::uint64_t>(pid);
+}
+
+template <typename WaitPolicyT>
+void test_shm_atomic_observer(const std::string& topic_id) {
+  auto notifier = ipcpp::event::ShmAtomicNotifier::create(topic_id);
+  ASSERT_TRUE(notifier.has_value());
+  auto observer = ipcpp::event::BasicShmAtomicObserver<WaitPolicyT>::create(topic_id);
+  ASSERT_TRUE(observer.has_value());
+
+  std::uint64_t received = 0;
+  std::thread observer_thread([&]() {
+    for (int i = 0; i < 3; ++i) {
+      received = observer->receive();
+    }
+  });
+  for (int i = 0; i < 3; ++i) {
+    std::this_thread::sleep_for(20ms);
+    notifier->notify_observers();
+  }
+  observer_thread.join();
+  EXPECT_EQ(received, 3);
+  EXPECT_FALSE(observer->has_new_data());
+}
+
+}  // namespace
+
+TEST(ipcpp_shm_atomic_observer, wait_policies) {
+  test_shm_atomic_observer<ipcpp::event::wait_policy::BusySpin>("ipcpp_test_shm_atomic_busy_spin");
+  test_shm_atomic_observer<ipcpp::event::wait_policy::SpinYield<>>("ipcpp_test_shm_atomic_spin_yield");
+  test_shm_atomic_observer<ipcpp::event::wait_policy::SpinThenPark<0>>("ipcpp_test_shm_atomic_park");
+}
+
+TEST(ipcpp_wait_policy, backoff) {
+  std::atomic<std::uint32_t> futex = 0;
+  std::atomic<std::uint32_t> num_waiters = 0;
+  const ipcpp::FutexWaitHandle handle{&futex, &num_waiters};
+  constexpr ipcpp::ps::WaitStrategy strategy{.spin_iterations = 2, .yield_iterations = 2, .park = true};
+
+  // spinning and yielding never park
+  for (std::uint64_t iteration = 0; iteration < 4; ++iteration) {
+    EXPECT_TRUE(ipcpp::event::wait_policy::backoff(strategy, iteration, handle, [] { return false; }, 10s));
+  }
+  // parking is bounded by the timeout and unregisters the waiter again
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(ipcpp::event::wait_policy::backoff(strategy, 4, handle, [] { return false; }, 20ms));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+  EXPECT_EQ(num_waiters.load(), 0);
+  // a ready event source is not waited for
+  EXPECT_TRUE(ipcpp::event::wait_policy::backoff(strategy, 4, handle, [] { return true; }, 10s));
+
+  std::thread notifier([&]() {
+    while (num_waiters.load() == 0) {
+      std::this_thread::yield();
+    }
+    futex.fetch_add(1);
+    ipcpp::futex_wake(futex);
+  });
+  EXPECT_TRUE(ipcpp::event::wait_policy::backoff(strategy, 4, handle, [] { return false; }, 10s));
+  notifier.join();
+}
+
+TEST(ipcpp_shm_atomic_observer, subscription_table) {
+  // observers may attach before the notifier exists
+  auto observer = ipcpp::event::ShmAtomicObserver::create("ipcpp_test_shm_atomic_subscriptions");
+  ASSERT_TRUE(observer.has_value());
+  auto notifier = ipcpp::event::ShmAtomicNotifier::create("ipcpp_test_shm_atomic_subscriptions");
+  ASSERT_TRUE(notifier.has_value());
+  EXPECT_EQ(notifier->num_observers(), 1);
+  {
+    auto second = ipcpp::event::ShmAtomicObserver::create("ipcpp_test_shm_atomic_subscriptions");
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(notifier->num_observers(), 2);
+  }
+  EXPECT_EQ(notifier->num_observers(), 1);
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(notifier->num_observers(10ms), 0);
+  observer->heartbeat();
+  EXPECT_EQ(notifier->num_observers(10ms), 1);
+}
+
+TEST(ipcpp_shm_subscription_table, reclaim_dead_observer) {
+  ipcpp::event::ShmSubscriptionTable<3> table{};
+  const std::uint64_t dead = dead_pid();
+  ASSERT_FALSE(ipcpp::utils::system::is_process_alive(dead));
+  table.slots[0].pid.store(dead);
+
+  // the first pass prefers free slots, slots of dead observers are only reclaimed once all others are taken
+  EXPECT_EQ(table.subscribe(), 1);
+  EXPECT_EQ(table.subscribe(), 2);
+  EXPECT_EQ(table.num_subscribers(), 3);
+  auto reclaimed = table.subscribe();
+  ASSERT_TRUE(reclaimed.has_value());
+  EXPECT_EQ(reclaimed.value(), 0);
+  EXPECT_EQ(table.slots[0].pid.load(), ipcpp::utils::system::get_pid());
+
+  // all slots are held by an alive process
+  auto full = table.subscribe();
+  ASSERT_FALSE(full.has_value());
+  EXPECT_EQ(full.error(), std::errc::too_many_files_open);
+  table.unsubscribe(1);
+  EXPECT_EQ(table.subscribe(), 1);
+}
+
+TEST(ipcpp_shm_subscription_table, heartbeat_expiry) {
+  ipcpp::event::ShmSubscriptionTable<2> table{};
+  auto first = table.subscribe();
+  ASSERT_TRUE(first.has_value());
+  auto second = table.subscribe();
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(table.num_subscribers(10ms), 2);
+
+  std::this_thread::sleep_for(20ms);
+  // expired observers are not counted but keep their slot
+  EXPECT_EQ(table.num_subscribers(10ms), 0);
+  EXPECT_EQ(table.num_subscribers(), 2);
+  table.heartbeat(second.value());
+  EXPECT_EQ(table.num_subscribers(10ms), 1);
+  EXPECT_FALSE(table.subscribe().has_value());
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/event/shm_cond_var_notifier.h>
+#include <ipcpp/event/shm_cond_var_observer.h>
+#include <ipcpp/utils/mutex.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using ipcpp::event::ShmCondVarNotifier;
+using ipcpp::event::ShmCondVarObserver;
+
+using namespace std::chrono_literals;
+
+TEST(ipcpp_condition_variable, notify_wait) {
+  ipcpp::futex mutex;
+  ipcpp::condition_variable cv;
+  bool ready = false;
+  int value = 0;
+
+  std::thread waiter([&]() {
+    std::unique_lock lock(mutex);
+    cv.wait(lock, [&]() { return ready; });
+    value = 1;
+  });
+  std::this_thread::sleep_for(10ms);
+  {
+    std::unique_lock lock(mutex);
+    ready = true;
+  }
+  cv.notify_one();
+  waiter.join();
+  EXPECT_EQ(value, 1);
+}
+
+TEST(ipcpp_condition_variable, wait_for_timeout) {
+  ipcpp::futex mutex;
+  ipcpp::condition_variable cv;
+  std::unique_lock lock(mutex);
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(cv.wait_for(lock, 20ms), std::cv_status::timeout);
+  EXPECT_FALSE(cv.wait_for(lock, 20ms, []() { return false; }));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 40ms);
+  // the lock is held again after a timeout
+  EXPECT_FALSE(mutex.try_lock());
+  EXPECT_TRUE(cv.wait_for(lock, 20ms, []() { return true; }));
+}
+
+TEST(ipcpp_shm_cond_var, notify_receive) {
+  auto notifier = ShmCondVarNotifier<int>::create("ipcpp_test_shm_cond_var_receive");
+  ASSERT_TRUE(notifier.has_value());
+  auto observer = ShmCondVarObserver<int>::create("ipcpp_test_shm_cond_var_receive");
+  ASSERT_TRUE(observer.has_value());
+  EXPECT_EQ(notifier->num_observers(), 1);
+
+  EXPECT_EQ(observer->try_receive().error(), std::errc::no_message_available);
+  EXPECT_EQ(observer->receive(10ms).error(), std::errc::timed_out);
+
+  notifier->notify_observers(1);
+  notifier->notify_observers(2);
+  EXPECT_EQ(observer->receive(), 1);
+  EXPECT_EQ(observer->receive(10ms), 2);
+
+  // a blocked observer is woken up
+  std::thread delayed([&]() {
+    std::this_thread::sleep_for(20ms);
+    notifier->notify_observers(3);
+  });
+  EXPECT_EQ(observer->receive(5s), 3);
+  delayed.join();
+}
+
+TEST(ipcpp_shm_cond_var, overrun) {
+  auto notifier = ShmCondVarNotifier<int>::create("ipcpp_test_shm_cond_var_overrun", 4);
+  ASSERT_TRUE(notifier.has_value());
+  auto observer = ShmCondVarObserver<int>::create("ipcpp_test_shm_cond_var_overrun");
+  ASSERT_TRUE(observer.has_value());
+
+  // the queue is rounded up to the mapped size: publish far more notifications than fit
+  constexpr int num_notifications = 10000;
+  for (int i = 1; i <= num_notifications; ++i) {
+    notifier->notify_observers(i);
+  }
+  EXPECT_EQ(observer->receive(10ms).error(), std::errc::value_too_large);
+  // continues with the oldest notification that was not overwritten
+  auto oldest = observer->receive(10ms);
+  ASSERT_TRUE(oldest.has_value());
+  EXPECT_GT(oldest.value(), 1);
+  for (int i = oldest.value() + 1; i <= num_notifications; ++i) {
+    EXPECT_EQ(observer->receive(10ms), i);
+  }
+  EXPECT_EQ(observer->try_receive().error(), std::errc::no_message_available);
+}
+
+TEST(ipcpp_shm_cond_var, create_timeout) {
+  const auto start = std::chrono::steady_clock::now();
+  auto observer = ShmCondVarObserver<int>::create("ipcpp_test_shm_cond_var_no_notifier", 20ms);
+  ASSERT_FALSE(observer.has_value());
+  EXPECT_EQ(observer.error(), std::errc::timed_out);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+}
+
+TEST(ipcpp_shm_cond_var, cross_process_wake) {
+  auto notifier = ShmCondVarNotifier<int>::create("ipcpp_test_shm_cond_var_fork");
+  ASSERT_TRUE(notifier.has_value());
+
+  const pid_t pid = fork();
+  if (pid == 0) {
+    auto observer = ShmCondVarObserver<int>::create("ipcpp_test_shm_cond_var_fork");
+    if (!observer.has_value()) {
+      _exit(1);
+    }
+    auto notification = observer->receive(5s);
+    _exit(notification.has_value() && notification.value() == 42 ? 0 : 2);
+  }
+  ASSERT_NE(pid, -1);
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (notifier->num_observers() == 0 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  ASSERT_EQ(notifier->num_observers(), 1);
+  // give the child time to block on the condition variable
+  std::this_thread::sleep_for(20ms);
+  notifier->notify_observers(42);
+
+  int status = -1;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+}
@@ -0,0 +1,102 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/publish_subscribe/message_queue/message_queue_publisher.h>
+#include <ipcpp/publish_subscribe/message_queue/message_queue_subscriber.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(ipcpp_message_queue, fetch_message) {
+  auto publisher = ipcpp::ps::MessageQueuePublisher<int>::create("ipcpp_test_mq_fetch_message", {.queue_capacity = 8});
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber_a = ipcpp::ps::MessageQueueSubscriber<int>::create("ipcpp_test_mq_fetch_message");
+  ASSERT_TRUE(subscriber_a.has_value());
+  auto subscriber_b = ipcpp::ps::MessageQueueSubscriber<int>::create("ipcpp_test_mq_fetch_message");
+  ASSERT_TRUE(subscriber_b.has_value());
+
+  EXPECT_FALSE(subscriber_a->fetch_message().has_value());
+  EXPECT_FALSE(publisher->publish(1));
+  EXPECT_FALSE(publisher->publish(2));
+  {
+    auto message = subscriber_b->fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(**message, 1);
+  }
+  {
+    auto message = subscriber_a->fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(**message, 2);
+  }
+  EXPECT_FALSE(subscriber_a->fetch_message().has_value());
+  EXPECT_FALSE(subscriber_b->fetch_message().has_value());
+}
+
+TEST(ipcpp_message_queue, backpressure) {
+  auto publisher = ipcpp::ps::MessageQueuePublisher<int>::create(
+      "ipcpp_test_mq_backpressure", {.queue_capacity = 4, .backpressure_policy = ipcpp::ps::BackpressurePolicy::ReturnError});
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = ipcpp::ps::MessageQueueSubscriber<int>::create("ipcpp_test_mq_backpressure");
+  ASSERT_TRUE(subscriber.has_value());
+
+  int published = 0;
+  while (!publisher->publish(published)) {
+    ++published;
+  }
+  EXPECT_EQ(published, publisher->capacity());
+  EXPECT_EQ(publisher->publish(-1), std::errc::no_buffer_space);
+
+  auto replacing = ipcpp::ps::MessageQueuePublisher<int>::create(
+      "ipcpp_test_mq_backpressure", {.backpressure_policy = ipcpp::ps::BackpressurePolicy::ReplaceOldest});
+  ASSERT_TRUE(replacing.has_value());
+  EXPECT_FALSE(replacing->publish(published));
+
+  for (int expected = 1; expected <= published; ++expected) {
+    auto message = subscriber->fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(**message, expected);
+  }
+  EXPECT_FALSE(subscriber->fetch_message().has_value());
+}
+
+TEST(ipcpp_message_queue, work_distribution) {
+  constexpr int num_messages = 10000;
+  constexpr int num_subscribers = 3;
+  auto publisher = ipcpp::ps::MessageQueuePublisher<int>::create(
+      "ipcpp_test_mq_work_distribution",
+      {.queue_capacity = 64, .backpressure_policy = ipcpp::ps::BackpressurePolicy::Blocking});
+  ASSERT_TRUE(publisher.has_value());
+
+  std::vector<std::atomic<int>> received(num_messages);
+  std::atomic<int> num_received = 0;
+  std::vector<std::thread> subscribers;
+  for (int i = 0; i < num_subscribers; ++i) {
+    subscribers.emplace_back([&]() {
+      auto subscriber = ipcpp::ps::MessageQueueSubscriber<int>::create("ipcpp_test_mq_work_distribution");
+      ASSERT_TRUE(subscriber.has_value());
+      while (num_received.load() < num_messages) {
+        if (auto message = subscriber->fetch_message(); message) {
+          received[**message].fetch_add(1);
+          num_received.fetch_add(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (int i = 0; i < num_messages; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+  }
+  for (auto& subscriber : subscribers) {
+    subscriber.join();
+  }
+  for (const auto& count : received) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
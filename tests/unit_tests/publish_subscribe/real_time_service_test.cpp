@@ -2,4 +2,487 @@
 // Created by leon- on 19/04/2025.
 //
 
-#include <gtest/gtest.h>
\ No newline at end of file
+#include <gtest/gtest.h>
+#include <ipcpp/publish_subscribe/publisher_lifecycle.h>
+#include <ipcpp/publish_subscribe/real_time/real_time_publisher.h>
+#include <ipcpp/publish_subscribe/real_time/real_time_subscriber.h>
+#include <ipcpp/publish_subscribe/real_time/seqlock_publisher.h>
+#include <ipcpp/publish_subscribe/real_time/seqlock_subscriber.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(ipcpp_real_time, fetch_message) {
+  auto publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_fetch_message");
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_fetch_message");
+  ASSERT_TRUE(subscriber.has_value());
+
+  EXPECT_FALSE(subscriber->fetch_message().has_value());
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+    auto message = subscriber->fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(**message, i);
+  }
+}
+
+TEST(ipcpp_real_time, await_message_wakes_parked_subscriber) {
+  auto publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_await_message");
+  ASSERT_TRUE(publisher.has_value());
+  // park immediately
+  auto subscriber = ipcpp::ps::RealTimeSubscriber<int>::create(
+      "ipcpp_test_rt_await_message", {.wait_strategy = {.spin_iterations = 0, .yield_iterations = 0, .park = true}});
+  ASSERT_TRUE(subscriber.has_value());
+
+  int received = -1;
+  std::thread subscriber_thread([&]() { received = *subscriber->await_message(); });
+  std::this_thread::sleep_for(50ms);
+  EXPECT_FALSE(publisher->publish(42));
+  subscriber_thread.join();
+  EXPECT_EQ(received, 42);
+}
+
+TEST(ipcpp_real_time, multiple_publishers) {
+  constexpr ipcpp::ps::Options<ipcpp::ps::Mode::RealTime> options{.max_publishers = 2, .max_subscribers = 2};
+  auto publisher_a = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_multiple_publishers", options);
+  ASSERT_TRUE(publisher_a.has_value());
+  auto publisher_b = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_multiple_publishers", options);
+  ASSERT_TRUE(publisher_b.has_value());
+  auto newest = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_multiple_publishers");
+  ASSERT_TRUE(newest.has_value());
+  auto round_robin = ipcpp::ps::RealTimeSubscriber<int>::create(
+      "ipcpp_test_rt_multiple_publishers", {.merge_policy = ipcpp::ps::PublisherMergePolicy::RoundRobin});
+  ASSERT_TRUE(round_robin.has_value());
+
+  EXPECT_FALSE(publisher_a->publish(1));
+  std::this_thread::sleep_for(1ms);
+  EXPECT_FALSE(publisher_b->publish(2));
+
+  {
+    auto message = newest->fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(**message, 2);
+  }
+  EXPECT_FALSE(newest->fetch_message().has_value());
+
+  for (int expected : {1, 2}) {
+    auto message = round_robin->fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(**message, expected);
+  }
+  EXPECT_FALSE(round_robin->fetch_message().has_value());
+}
+
+TEST(ipcpp_real_time, loan) {
+  struct Frame {
+    int id = 0;
+    std::array<int, 64> data{};
+  };
+  auto publisher = ipcpp::ps::RealTimePublisher<Frame>::create("ipcpp_test_rt_loan");
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = ipcpp::ps::RealTimeSubscriber<Frame>::create("ipcpp_test_rt_loan");
+  ASSERT_TRUE(subscriber.has_value());
+
+  {
+    auto loan = publisher->loan();
+    ASSERT_TRUE(loan);
+    loan->id = 1;
+    loan->data.fill(7);
+    EXPECT_FALSE(subscriber->fetch_message().has_value());
+    EXPECT_FALSE(publisher->publish(std::move(loan)));
+    EXPECT_FALSE(loan);
+  }
+  {
+    auto message = subscriber->fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ((*message)->id, 1);
+    EXPECT_EQ((*message)->data[63], 7);
+  }
+
+  auto discarded = publisher->loan();
+  discarded->id = 2;
+  publisher->discard(std::move(discarded));
+  EXPECT_FALSE(subscriber->fetch_message().has_value());
+
+  // an outstanding loan is not handed out by publish()
+  auto outstanding = publisher->loan();
+  outstanding->id = 3;
+  EXPECT_FALSE(publisher->publish(Frame{.id = 4}));
+  EXPECT_EQ(outstanding->id, 3);
+  EXPECT_FALSE(publisher->publish(std::move(outstanding)));
+  auto message = subscriber->fetch_message();
+  ASSERT_TRUE(message.has_value());
+  EXPECT_EQ((*message)->id, 3);
+}
+
+TEST(ipcpp_real_time, loan_with_pinned_pool) {
+  constexpr ipcpp::ps::Options<ipcpp::ps::Mode::RealTime> options{.max_subscribers = 1, .max_concurrent_acquires = 2};
+  auto publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_loan_pinned", options);
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_loan_pinned");
+  ASSERT_TRUE(subscriber.has_value());
+
+  // all acquires are taken and the publisher holds the latest message in a third slot
+  EXPECT_FALSE(publisher->publish(1));
+  auto first = subscriber->fetch_message();
+  ASSERT_TRUE(first.has_value());
+  EXPECT_FALSE(publisher->publish(2));
+  auto second = subscriber->fetch_message();
+  ASSERT_TRUE(second.has_value());
+  EXPECT_FALSE(publisher->publish(3));
+  EXPECT_EQ(publisher->num_acquired_messages(), 2);
+
+  // an outstanding loan does not take the slot publish() writes to
+  auto loan = publisher->loan();
+  ASSERT_TRUE(loan);
+  *loan = 5;
+  EXPECT_FALSE(publisher->publish(4));
+  EXPECT_FALSE(publisher->publish(std::move(loan)));
+  first = std::unexpected(std::make_error_code(std::errc::no_message_available));
+  auto latest = subscriber->fetch_message();
+  ASSERT_TRUE(latest.has_value());
+  EXPECT_EQ(**latest, 5);
+}
+
+TEST(ipcpp_real_time, latched_subscription) {
+  auto publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_latched", {.max_subscribers = 2});
+  ASSERT_TRUE(publisher.has_value());
+  EXPECT_FALSE(publisher->publish(42));
+
+  auto volatile_subscriber = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_latched");
+  ASSERT_TRUE(volatile_subscriber.has_value());
+  EXPECT_FALSE(volatile_subscriber->fetch_message().has_value());
+
+  auto latched_subscriber = ipcpp::ps::RealTimeSubscriber<int>::create(
+      "ipcpp_test_rt_latched", {.subscription_mode = ipcpp::ps::RealTimeSubscriptionMode::Latched});
+  ASSERT_TRUE(latched_subscriber.has_value());
+  // the latched message stays valid although the publisher moved on
+  EXPECT_FALSE(publisher->publish(43));
+  {
+    auto message = latched_subscriber->fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(**message, 42);
+  }
+  auto message = latched_subscriber->fetch_message();
+  ASSERT_TRUE(message.has_value());
+  EXPECT_EQ(**message, 43);
+}
+
+TEST(ipcpp_real_time, latched_subscription_acquire_limit) {
+  constexpr ipcpp::ps::Options<ipcpp::ps::Mode::RealTime> options{
+      .max_publishers = 1, .max_subscribers = 3, .max_concurrent_acquires = 1, .max_total_acquires = 1};
+  auto publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_latched_limit", options);
+  ASSERT_TRUE(publisher.has_value());
+  EXPECT_FALSE(publisher->publish(1));
+
+  constexpr ipcpp::ps::SubscriberOptions<ipcpp::ps::Mode::RealTime> latched{
+      .subscription_mode = ipcpp::ps::RealTimeSubscriptionMode::Latched};
+  std::vector<ipcpp::ps::RealTimeSubscriber<int>> subscribers;
+  for (int i = 0; i < 3; ++i) {
+    auto subscriber = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_latched_limit", latched);
+    ASSERT_TRUE(subscriber.has_value());
+    subscribers.push_back(std::move(subscriber.value()));
+  }
+  // only the first subscriber latched a message, the others were rejected by the topic wide limit
+  EXPECT_EQ(publisher->num_acquired_messages(), 1);
+  EXPECT_TRUE(subscribers[0].has_new_data());
+  EXPECT_FALSE(subscribers[1].has_new_data());
+
+  // latched subscribers that never fetch do not pin every slot
+  for (int i = 2; i < 100; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+  }
+  {
+    auto message = subscribers[0].fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(**message, 1);
+    EXPECT_EQ(publisher->num_acquired_messages(), 1);
+  }
+  EXPECT_EQ(publisher->num_acquired_messages(), 0);
+
+  // a latched message that is never fetched is released with its subscriber
+  subscribers.clear();
+  auto subscriber = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_latched_limit", latched);
+  ASSERT_TRUE(subscriber.has_value());
+  EXPECT_EQ(publisher->num_acquired_messages(), 1);
+  subscriber = std::unexpected(std::make_error_code(std::errc::no_message_available));
+  EXPECT_EQ(publisher->num_acquired_messages(), 0);
+}
+
+TEST(ipcpp_real_time, acquire_limits) {
+  constexpr ipcpp::ps::Options<ipcpp::ps::Mode::RealTime> options{
+      .max_publishers = 1, .max_subscribers = 2, .max_concurrent_acquires = 4, .max_total_acquires = 3};
+  using buffer_type = ipcpp::ps::RealTimeMessageBuffer<ipcpp::ps::rt::Message<int>>;
+  EXPECT_EQ(buffer_type::per_publisher_pool_size({.max_subscribers = 2, .max_concurrent_acquires = 4}), 16);
+  EXPECT_EQ(buffer_type::per_publisher_pool_size(options), 8);
+  auto publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_acquire_limits", options);
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber_a = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_acquire_limits");
+  ASSERT_TRUE(subscriber_a.has_value());
+  auto subscriber_b = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_acquire_limits");
+  ASSERT_TRUE(subscriber_b.has_value());
+
+  EXPECT_FALSE(publisher->publish(1));
+  auto a_1 = subscriber_a->fetch_message();
+  ASSERT_TRUE(a_1.has_value());
+  auto b_1 = subscriber_b->fetch_message();
+  ASSERT_TRUE(b_1.has_value());
+  EXPECT_FALSE(publisher->publish(2));
+  auto a_2 = subscriber_a->fetch_message();
+  ASSERT_TRUE(a_2.has_value());
+  EXPECT_EQ(publisher->num_acquired_messages(), 3);
+
+  // topic wide limit reached
+  EXPECT_FALSE(publisher->publish(3));
+  EXPECT_EQ(subscriber_b->fetch_message().error(), std::errc::invalid_seek);
+  // a released acquire is visible to the publisher and can be reused
+  a_1 = std::unexpected(std::make_error_code(std::errc::no_message_available));
+  EXPECT_EQ(publisher->num_acquired_messages(), 2);
+  // the rejected message was not marked as read
+  EXPECT_TRUE(subscriber_b->has_new_data());
+  {
+    auto b_3 = subscriber_b->fetch_message();
+    ASSERT_TRUE(b_3.has_value());
+    EXPECT_EQ(**b_3, 3);
+  }
+  EXPECT_EQ(publisher->num_acquired_messages(), 2);
+  EXPECT_FALSE(publisher->publish(4));
+  auto b_2 = subscriber_b->fetch_message();
+  ASSERT_TRUE(b_2.has_value());
+  EXPECT_EQ(**b_2, 4);
+}
+
+TEST(ipcpp_real_time, message_wrapper_move) {
+  constexpr ipcpp::ps::Options<ipcpp::ps::Mode::RealTime> options{.max_subscribers = 1, .max_concurrent_acquires = 4};
+  auto publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_wrapper_move", options);
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_wrapper_move");
+  ASSERT_TRUE(subscriber.has_value());
+
+  EXPECT_FALSE(publisher->publish(1));
+  auto first = subscriber->fetch_message();
+  ASSERT_TRUE(first.has_value());
+  EXPECT_FALSE(publisher->publish(2));
+  auto second = subscriber->fetch_message();
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(publisher->num_acquired_messages(), 2);
+
+  {
+    // move construction transfers the acquire
+    auto moved = std::move(first.value());
+    EXPECT_EQ(publisher->num_acquired_messages(), 2);
+    // move assignment releases the acquire of the target and transfers the one of the source
+    moved = std::move(second.value());
+    EXPECT_EQ(publisher->num_acquired_messages(), 1);
+    EXPECT_EQ(*moved, 2);
+  }
+  EXPECT_EQ(publisher->num_acquired_messages(), 0);
+  first = std::unexpected(std::make_error_code(std::errc::no_message_available));
+  second = std::unexpected(std::make_error_code(std::errc::no_message_available));
+  EXPECT_EQ(publisher->num_acquired_messages(), 0);
+}
+
+TEST(ipcpp_real_time, free_slot_bitmap) {
+  // 2 bitmap words per publisher pool
+  constexpr ipcpp::ps::Options<ipcpp::ps::Mode::RealTime> options{.max_subscribers = 1, .max_concurrent_acquires = 100};
+  auto publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_free_slot_bitmap", options);
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_free_slot_bitmap");
+  ASSERT_TRUE(subscriber.has_value());
+
+  std::vector<ipcpp::ps::RealTimeSubscriber<int>::MessageWrapper> pinned;
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+    auto message = subscriber->fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(**message, i);
+    // keep every other message pinned, leaving one acquire for fetching
+    if (i % 2 == 0 && pinned.size() < 99) {
+      pinned.push_back(std::move(message.value()));
+    }
+  }
+  for (int i = 0; i < 99; ++i) {
+    EXPECT_EQ(*pinned[i], 2 * i);
+  }
+}
+
+TEST(ipcpp_real_time, seqlock_fetch_message) {
+  auto publisher = ipcpp::ps::SeqlockPublisher<int>::create("ipcpp_test_rt_seqlock_fetch_message");
+  ASSERT_TRUE(publisher.has_value());
+  EXPECT_FALSE(ipcpp::ps::SeqlockPublisher<int>::create("ipcpp_test_rt_seqlock_fetch_message").has_value());
+  EXPECT_FALSE(publisher->publish(1));
+
+  auto subscriber = ipcpp::ps::SeqlockSubscriber<int>::create("ipcpp_test_rt_seqlock_fetch_message");
+  ASSERT_TRUE(subscriber.has_value());
+  auto latched_subscriber = ipcpp::ps::SeqlockSubscriber<int>::create(
+      "ipcpp_test_rt_seqlock_fetch_message", {.subscription_mode = ipcpp::ps::RealTimeSubscriptionMode::Latched});
+  ASSERT_TRUE(latched_subscriber.has_value());
+
+  EXPECT_FALSE(subscriber->fetch_message().has_value());
+  EXPECT_EQ(latched_subscriber->fetch_message().value(), 1);
+  for (int i = 2; i < 32; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+    EXPECT_EQ(subscriber->fetch_message().value(), i);
+  }
+  // only the latest message is delivered
+  EXPECT_EQ(latched_subscriber->fetch_message().value(), 31);
+  EXPECT_FALSE(latched_subscriber->fetch_message().has_value());
+}
+
+TEST(ipcpp_real_time, seqlock_layout_errors) {
+  using buffer_type = ipcpp::ps::SeqlockRingBuffer<int>;
+  alignas(std::hardware_destructive_interference_size) std::array<std::byte, 4096> memory{};
+  const auto addr = reinterpret_cast<std::uintptr_t>(memory.data());
+  EXPECT_EQ(buffer_type::init_at(addr, 8, 4).error(), std::errc::no_buffer_space);
+  EXPECT_EQ(buffer_type::read_at(addr, 10ms).error(), std::errc::timed_out);
+}
+
+TEST(ipcpp_real_time, seqlock_await_message_park) {
+  auto publisher = ipcpp::ps::SeqlockPublisher<int>::create("ipcpp_test_rt_seqlock_park");
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = ipcpp::ps::SeqlockSubscriber<int>::create(
+      "ipcpp_test_rt_seqlock_park",
+      {.wait_strategy = {.spin_iterations = 0, .yield_iterations = 0, .park = true}, .liveness_check_interval = 20ms});
+  ASSERT_TRUE(subscriber.has_value());
+  EXPECT_FALSE(subscriber->has_new_data());
+
+  // the parked subscriber wakes up on publish and keeps on waiting across liveness timeouts
+  std::thread publisher_thread([&]() {
+    std::this_thread::sleep_for(100ms);
+    EXPECT_FALSE(publisher->publish(1));
+  });
+  EXPECT_EQ(subscriber->await_message(), 1);
+  publisher_thread.join();
+  EXPECT_FALSE(subscriber->has_new_data());
+}
+
+TEST(ipcpp_real_time, seqlock_no_torn_reads) {
+  struct Sample {
+    std::array<std::int64_t, 16> values;
+  };
+  constexpr std::int64_t num_messages = 100000;
+  auto publisher = ipcpp::ps::SeqlockPublisher<Sample>::create("ipcpp_test_rt_seqlock_no_torn_reads");
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = ipcpp::ps::SeqlockSubscriber<Sample>::create("ipcpp_test_rt_seqlock_no_torn_reads");
+  ASSERT_TRUE(subscriber.has_value());
+
+  std::thread subscriber_thread([&]() {
+    std::int64_t last = -1;
+    while (last < num_messages - 1) {
+      Sample sample = subscriber->await_message();
+      for (auto value : sample.values) {
+        ASSERT_EQ(value, sample.values[0]);
+      }
+      ASSERT_GT(sample.values[0], last);
+      last = sample.values[0];
+    }
+  });
+  for (std::int64_t i = 0; i < num_messages; ++i) {
+    Sample sample;
+    sample.values.fill(i);
+    EXPECT_FALSE(publisher->publish(sample));
+  }
+  subscriber_thread.join();
+}
+
+TEST(ipcpp_real_time, publish_interval_coalesces_messages) {
+  auto publisher =
+      ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_publish_interval", {.publish_interval = 200ms});
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_rt_publish_interval");
+  ASSERT_TRUE(subscriber.has_value());
+  auto fetch_value = [&subscriber]() {
+    auto message = subscriber->fetch_message();
+    return message.has_value() ? **message : -1;
+  };
+
+  // the first message opens the interval and is published immediately
+  EXPECT_FALSE(publisher->publish(0));
+  EXPECT_EQ(fetch_value(), 0);
+
+  // a burst within the interval collapses to its latest message without reaching subscribers
+  for (int i = 1; i < 100; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+  }
+  EXPECT_TRUE(publisher->has_pending());
+  EXPECT_FALSE(subscriber->has_new_data());
+  EXPECT_FALSE(publisher->flush_if_due());
+
+  std::this_thread::sleep_for(250ms);
+  EXPECT_TRUE(publisher->flush_if_due());
+  EXPECT_FALSE(publisher->has_pending());
+  EXPECT_EQ(fetch_value(), 99);
+
+  EXPECT_FALSE(publisher->publish(100));
+  EXPECT_TRUE(publisher->flush());
+  EXPECT_EQ(fetch_value(), 100);
+}
+
+TEST(ipcpp_real_time, publisher_lifecycle_generations) {
+  ipcpp::ps::PublisherLifecycle lifecycle;
+  std::atomic<std::uint32_t> notification_futex = 0;
+  std::optional<ipcpp::ps::internal::PublisherLifecycleGuard> previous;
+  previous.emplace(&lifecycle, &notification_futex, 1);
+  EXPECT_TRUE(ipcpp::ps::PublisherLifecycle::is_alive(lifecycle.state.load()));
+
+  // a successor took over before the previous publisher shut down: it stays alive
+  ipcpp::ps::internal::PublisherLifecycleGuard successor(&lifecycle, &notification_futex, 2);
+  previous.reset();
+  EXPECT_TRUE(ipcpp::ps::PublisherLifecycle::is_alive(lifecycle.state.load()));
+  EXPECT_EQ(ipcpp::ps::PublisherLifecycle::generation(lifecycle.state.load()), 2);
+  EXPECT_FALSE(lifecycle.set_down(1));
+  EXPECT_TRUE(lifecycle.set_down(2));
+  EXPECT_FALSE(ipcpp::ps::PublisherLifecycle::is_alive(lifecycle.state.load()));
+  EXPECT_FALSE(lifecycle.set_down(2));
+}
+
+TEST(ipcpp_real_time, publisher_down) {
+  auto e_publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_publisher_down");
+  ASSERT_TRUE(e_publisher.has_value());
+  std::optional<ipcpp::ps::RealTimePublisher<int>> publisher(std::move(e_publisher.value()));
+  auto subscriber = ipcpp::ps::RealTimeSubscriber<int>::create(
+      "ipcpp_test_rt_publisher_down",
+      {.wait_strategy = {.spin_iterations = 0, .yield_iterations = 0, .park = true}, .liveness_check_interval = 20ms});
+  ASSERT_TRUE(subscriber.has_value());
+  EXPECT_TRUE(subscriber->has_alive_publisher());
+  EXPECT_EQ(subscriber->fetch_message().error(), std::errc::no_message_available);
+
+  // a regular shutdown wakes the parked subscriber immediately
+  std::error_code error;
+  std::thread subscriber_thread([&]() { error = subscriber->await_get_message().error(); });
+  std::this_thread::sleep_for(50ms);
+  publisher.reset();
+  subscriber_thread.join();
+  EXPECT_EQ(error, std::errc::owner_dead);
+  EXPECT_FALSE(subscriber->has_alive_publisher());
+
+  // a crashed publisher (next generation in a child process) is detected by parked subscribers
+  const pid_t pid = fork();
+  if (pid == 0) {
+    auto crashing_publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_rt_publisher_down");
+    _exit(crashing_publisher.has_value() && !crashing_publisher->publish(1) ? 0 : 1);
+  }
+  int status = -1;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+  EXPECT_TRUE(subscriber->has_alive_publisher());
+  {
+    auto message = subscriber->fetch_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(**message, 1);
+  }
+  EXPECT_EQ(subscriber->await_get_message().error(), std::errc::owner_dead);
+  EXPECT_FALSE(subscriber->has_alive_publisher());
+}
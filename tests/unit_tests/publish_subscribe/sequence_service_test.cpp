@@ -0,0 +1,257 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_publisher.h>
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_subscriber.h>
+
+#include <optional>
+#include <thread>
+#include <vector>
+
+using ipcpp::publish_subscribe::Publisher;
+using ipcpp::publish_subscribe::Subscriber;
+
+TEST(ipcpp_sequence, backpressure_return_error) {
+  auto publisher = Publisher<int>::create(
+      "ipcpp_test_seq_return_error",
+      {.queue_capacity = 16, .backpressure_policy = ipcpp::ps::BackpressurePolicy::ReturnError});
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = Subscriber<int>::create("ipcpp_test_seq_return_error");
+  ASSERT_TRUE(subscriber.has_value());
+  subscriber->subscribe();
+
+  int published = 0;
+  while (!publisher->publish(published)) {
+    ++published;
+  }
+  EXPECT_GE(published, 16);
+  EXPECT_EQ(publisher->publish(-1), std::errc::no_buffer_space);
+
+  // consuming the oldest message frees its slot
+  int received = -1;
+  EXPECT_FALSE(subscriber->receive([&received](const int& value) {
+    received = value;
+    return std::error_code{};
+  }));
+  EXPECT_EQ(received, 0);
+  EXPECT_FALSE(publisher->publish(published));
+}
+
+TEST(ipcpp_sequence, backpressure_replace_oldest) {
+  auto publisher = Publisher<int>::create(
+      "ipcpp_test_seq_replace_oldest",
+      {.queue_capacity = 16, .backpressure_policy = ipcpp::ps::BackpressurePolicy::ReplaceOldest});
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = Subscriber<int>::create("ipcpp_test_seq_replace_oldest");
+  ASSERT_TRUE(subscriber.has_value());
+  subscriber->subscribe();
+
+  for (int i = 0; i < 4096; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+  }
+}
+
+TEST(ipcpp_sequence, backpressure_blocking) {
+  constexpr int num_messages = 10000;
+  auto publisher = Publisher<int>::create(
+      "ipcpp_test_seq_blocking", {.queue_capacity = 16, .backpressure_policy = ipcpp::ps::BackpressurePolicy::Blocking});
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = Subscriber<int>::create("ipcpp_test_seq_blocking");
+  ASSERT_TRUE(subscriber.has_value());
+  subscriber->subscribe();
+
+  std::vector<int> received;
+  std::thread subscriber_thread([&]() {
+    while (received.size() < num_messages) {
+      auto e_num = subscriber->receive_batch(64, [&received](const int& value) {
+        received.push_back(value);
+        return std::error_code{};
+      });
+      ASSERT_TRUE(e_num.has_value());
+    }
+  });
+  for (int i = 0; i < num_messages; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+  }
+  subscriber_thread.join();
+
+  ASSERT_EQ(received.size(), num_messages);
+  for (int i = 0; i < num_messages; ++i) {
+    EXPECT_EQ(received[i], i);
+  }
+}
+
+TEST(ipcpp_sequence, receive_batch_max_messages) {
+  auto publisher = Publisher<int>::create(
+      "ipcpp_test_seq_batch_max",
+      {.queue_capacity = 16, .backpressure_policy = ipcpp::ps::BackpressurePolicy::ReturnError});
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = Subscriber<int>::create("ipcpp_test_seq_batch_max");
+  ASSERT_TRUE(subscriber.has_value());
+  subscriber->subscribe();
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+  }
+  std::vector<int> received;
+  auto collect = [&received](const int& value) {
+    received.push_back(value);
+    return std::error_code{};
+  };
+  // the batch is truncated to max_messages, the rest stays available
+  EXPECT_EQ(subscriber->receive_batch(4, collect), 4);
+  EXPECT_EQ(received, std::vector<int>({0, 1, 2, 3}));
+  EXPECT_TRUE(subscriber->has_new_data());
+  received.clear();
+  EXPECT_EQ(subscriber->receive_batch(100, collect), 6);
+  EXPECT_EQ(received, std::vector<int>({4, 5, 6, 7, 8, 9}));
+  EXPECT_FALSE(subscriber->has_new_data());
+}
+
+TEST(ipcpp_sequence, receive_batch_skips_overwritten_messages) {
+  auto publisher = Publisher<int>::create(
+      "ipcpp_test_seq_batch_overwritten",
+      {.queue_capacity = 16, .backpressure_policy = ipcpp::ps::BackpressurePolicy::ReplaceOldest});
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = Subscriber<int>::create("ipcpp_test_seq_batch_overwritten");
+  ASSERT_TRUE(subscriber.has_value());
+  subscriber->subscribe();
+
+  constexpr int num_messages = 1000;
+  for (int i = 0; i < num_messages; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+  }
+  std::vector<int> received;
+  auto e_num = subscriber->receive_batch(num_messages, [&received](const int& value) {
+    received.push_back(value);
+    return std::error_code{};
+  });
+  ASSERT_TRUE(e_num.has_value());
+  // only the messages that were not overwritten are passed to the callback, in order and ending with the latest
+  EXPECT_EQ(e_num.value(), received.size());
+  ASSERT_FALSE(received.empty());
+  EXPECT_LT(received.size(), num_messages);
+  EXPECT_EQ(received.back(), num_messages - 1);
+  for (std::size_t i = 1; i < received.size(); ++i) {
+    EXPECT_EQ(received[i], received[i - 1] + 1);
+  }
+  EXPECT_FALSE(subscriber->has_new_data());
+}
+
+TEST(ipcpp_sequence, receive_batch_callback_error) {
+  auto publisher = Publisher<int>::create(
+      "ipcpp_test_seq_batch_error",
+      {.queue_capacity = 16, .backpressure_policy = ipcpp::ps::BackpressurePolicy::ReturnError});
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = Subscriber<int>::create("ipcpp_test_seq_batch_error");
+  ASSERT_TRUE(subscriber.has_value());
+  subscriber->subscribe();
+
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+  }
+  std::vector<int> received;
+  auto e_num = subscriber->receive_batch(100, [&received](const int& value) {
+    received.push_back(value);
+    return value == 2 ? std::make_error_code(std::errc::invalid_argument) : std::error_code{};
+  });
+  // the batch stops at the first error
+  ASSERT_FALSE(e_num.has_value());
+  EXPECT_EQ(e_num.error(), std::errc::invalid_argument);
+  EXPECT_EQ(received, std::vector<int>({0, 1, 2}));
+
+  // the failed message counts as received: the next batch continues after it
+  received.clear();
+  e_num = subscriber->receive_batch(100, [&received](const int& value) {
+    received.push_back(value);
+    return std::error_code{};
+  });
+  EXPECT_EQ(e_num, 2);
+  EXPECT_EQ(received, std::vector<int>({3, 4}));
+  EXPECT_FALSE(subscriber->has_new_data());
+  // all consumed slots were released
+  for (int i = 5; i < 21; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+  }
+}
+
+TEST(ipcpp_sequence, publish_interval_coalesces_messages) {
+  auto publisher = Publisher<int>::create("ipcpp_test_seq_publish_interval",
+                                          {.queue_capacity = 16,
+                                           .backpressure_policy = ipcpp::ps::BackpressurePolicy::ReturnError,
+                                           .publish_interval = 200ms});
+  ASSERT_TRUE(publisher.has_value());
+  auto subscriber = Subscriber<int>::create("ipcpp_test_seq_publish_interval");
+  ASSERT_TRUE(subscriber.has_value());
+  subscriber->subscribe();
+  auto receive_value = [&subscriber]() {
+    int received = -1;
+    subscriber->receive([&received](const int& value) {
+      received = value;
+      return std::error_code{};
+    });
+    return received;
+  };
+
+  EXPECT_FALSE(publisher->publish(0));
+  EXPECT_EQ(receive_value(), 0);
+
+  // more messages than the queue holds: all of them share the one pending slot, so there is no backpressure
+  for (int i = 1; i < 100; ++i) {
+    EXPECT_FALSE(publisher->publish(i));
+  }
+  EXPECT_TRUE(publisher->has_pending());
+  EXPECT_FALSE(subscriber->has_new_data());
+
+  std::this_thread::sleep_for(250ms);
+  EXPECT_TRUE(publisher->flush_if_due());
+  EXPECT_EQ(receive_value(), 99);
+  EXPECT_FALSE(subscriber->has_new_data());
+
+  EXPECT_FALSE(publisher->publish(100));
+  EXPECT_TRUE(publisher->flush());
+  EXPECT_EQ(receive_value(), 100);
+}
+
+TEST(ipcpp_sequence, publisher_down_and_restart) {
+  auto e_publisher = Publisher<int>::create("ipcpp_test_seq_publisher_down", {.queue_capacity = 16});
+  ASSERT_TRUE(e_publisher.has_value());
+  std::optional<Publisher<int>> publisher(std::move(e_publisher.value()));
+  auto subscriber = Subscriber<int>::create("ipcpp_test_seq_publisher_down");
+  ASSERT_TRUE(subscriber.has_value());
+  subscriber->subscribe();
+  auto receive_value = [&subscriber](std::error_code& error) {
+    int received = -1;
+    error = subscriber->receive([&received](const int& value) {
+      received = value;
+      return std::error_code{};
+    });
+    return received;
+  };
+
+  std::error_code error;
+  EXPECT_FALSE(publisher->publish(1));
+  publisher.reset();
+  // messages published before the shutdown are still delivered
+  EXPECT_EQ(receive_value(error), 1);
+  EXPECT_FALSE(error);
+  receive_value(error);
+  EXPECT_EQ(error, std::errc::owner_dead);
+
+  // a new publisher starts the next generation: the subscription is renewed
+  e_publisher = Publisher<int>::create("ipcpp_test_seq_publisher_down", {.queue_capacity = 16});
+  ASSERT_TRUE(e_publisher.has_value());
+  EXPECT_FALSE(e_publisher->publish(2));
+  std::thread publisher_thread([&]() {
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(e_publisher->publish(3));
+  });
+  EXPECT_EQ(receive_value(error), 3);
+  EXPECT_FALSE(error);
+  publisher_thread.join();
+}
@@ -0,0 +1,124 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/event/shm_atomic_notifier.h>
+#include <ipcpp/event/shm_atomic_observer.h>
+#include <ipcpp/event/wait_set.h>
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_publisher.h>
+#include <ipcpp/publish_subscribe/fifo_seq/fifo_subscriber.h>
+#include <ipcpp/publish_subscribe/real_time/real_time_publisher.h>
+#include <ipcpp/publish_subscribe/real_time/real_time_subscriber.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(ipcpp_wait_set, real_time_topics) {
+  constexpr std::size_t num_topics = 4;
+  std::vector<ipcpp::ps::RealTimePublisher<int>> publishers;
+  std::vector<ipcpp::ps::RealTimeSubscriber<int>> subscribers;
+  for (std::size_t i = 0; i < num_topics; ++i) {
+    const std::string topic_id = "ipcpp_test_wait_set_rt_" + std::to_string(i);
+    auto publisher = ipcpp::ps::RealTimePublisher<int>::create(topic_id);
+    ASSERT_TRUE(publisher.has_value());
+    publishers.push_back(std::move(publisher.value()));
+    auto subscriber = ipcpp::ps::RealTimeSubscriber<int>::create(topic_id);
+    ASSERT_TRUE(subscriber.has_value());
+    subscribers.push_back(std::move(subscriber.value()));
+  }
+  ipcpp::event::WaitSet wait_set;
+  for (auto& subscriber : subscribers) {
+    ASSERT_TRUE(wait_set.add(subscriber).has_value());
+  }
+
+  auto e_timeout = wait_set.wait(10ms);
+  ASSERT_FALSE(e_timeout.has_value());
+  EXPECT_EQ(e_timeout.error(), std::errc::timed_out);
+
+  std::thread publisher_thread([&]() {
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(publishers[2].publish(42));
+  });
+  auto e_ready = wait_set.wait();
+  publisher_thread.join();
+  ASSERT_TRUE(e_ready.has_value());
+  ASSERT_EQ(e_ready->size(), 1);
+  EXPECT_EQ(e_ready->front(), 2);
+  auto message = subscribers[2].fetch_message();
+  ASSERT_TRUE(message.has_value());
+  EXPECT_EQ(**message, 42);
+}
+
+TEST(ipcpp_wait_set, mixed_sources) {
+  auto rt_publisher = ipcpp::ps::RealTimePublisher<int>::create("ipcpp_test_wait_set_mixed_rt");
+  ASSERT_TRUE(rt_publisher.has_value());
+  auto rt_subscriber = ipcpp::ps::RealTimeSubscriber<int>::create("ipcpp_test_wait_set_mixed_rt");
+  ASSERT_TRUE(rt_subscriber.has_value());
+
+  auto seq_publisher = ipcpp::publish_subscribe::Publisher<int>::create("ipcpp_test_wait_set_mixed_seq", {});
+  ASSERT_TRUE(seq_publisher.has_value());
+  auto seq_subscriber = ipcpp::publish_subscribe::Subscriber<int>::create("ipcpp_test_wait_set_mixed_seq");
+  ASSERT_TRUE(seq_subscriber.has_value());
+  seq_subscriber->subscribe();
+
+  auto notifier = ipcpp::event::ShmAtomicNotifier::create("ipcpp_test_wait_set_mixed_event");
+  ASSERT_TRUE(notifier.has_value());
+  auto observer = ipcpp::event::ShmAtomicObserver::create("ipcpp_test_wait_set_mixed_event");
+  ASSERT_TRUE(observer.has_value());
+
+  ipcpp::event::WaitSet wait_set;
+  const auto rt_idx = wait_set.add(rt_subscriber.value()).value();
+  const auto seq_idx = wait_set.add(seq_subscriber.value()).value();
+  const auto event_idx = wait_set.add(observer.value()).value();
+  EXPECT_EQ(wait_set.size(), 3);
+
+  std::thread notifier_thread([&]() {
+    std::this_thread::sleep_for(50ms);
+    notifier->notify_observers();
+  });
+  auto e_ready = wait_set.wait(5s);
+  notifier_thread.join();
+  ASSERT_TRUE(e_ready.has_value());
+  ASSERT_EQ(e_ready->size(), 1);
+  EXPECT_EQ(e_ready->front(), event_idx);
+  observer->receive();
+
+  std::thread publisher_thread([&]() {
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(seq_publisher->publish(7));
+  });
+  e_ready = wait_set.wait(5s);
+  publisher_thread.join();
+  ASSERT_TRUE(e_ready.has_value());
+  ASSERT_EQ(e_ready->size(), 1);
+  EXPECT_EQ(e_ready->front(), seq_idx);
+
+  EXPECT_FALSE(rt_publisher->publish(1));
+  e_ready = wait_set.wait(5s);
+  ASSERT_TRUE(e_ready.has_value());
+  EXPECT_EQ(e_ready->size(), 2);
+  EXPECT_EQ(e_ready->front(), rt_idx);
+}
+
+TEST(ipcpp_wait_set, no_sources) {
+  ipcpp::event::WaitSet wait_set;
+  EXPECT_EQ(wait_set.wait().error(), std::errc::invalid_argument);
+  EXPECT_EQ(wait_set.wait(10ms).error(), std::errc::invalid_argument);
+
+  auto notifier = ipcpp::event::ShmAtomicNotifier::create("ipcpp_test_wait_set_no_sources");
+  ASSERT_TRUE(notifier.has_value());
+  auto observer = ipcpp::event::ShmAtomicObserver::create("ipcpp_test_wait_set_no_sources");
+  ASSERT_TRUE(observer.has_value());
+  ASSERT_TRUE(wait_set.add(observer.value()).has_value());
+  EXPECT_EQ(wait_set.wait(10ms).error(), std::errc::timed_out);
+  wait_set.clear();
+  EXPECT_EQ(wait_set.wait().error(), std::errc::invalid_argument);
+}
@@ -0,0 +1,112 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/event/shm_notification_memory_layout.h>
+#include <ipcpp/shm/broadcast_ring_buffer.h>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Notification {
+  std::uint64_t id;
+  std::uint64_t checksum;
+};
+
+struct AlignedMemory {
+  explicit AlignedMemory(std::size_t size)
+      : size(size), data(static_cast<std::byte*>(::operator new(size, std::align_val_t{4096}))) {}
+  ~AlignedMemory() { ::operator delete(data, std::align_val_t{4096}); }
+  [[nodiscard]] std::uintptr_t addr() const { return reinterpret_cast<std::uintptr_t>(data); }
+  std::size_t size;
+  std::byte* data;
+};
+
+}  // namespace
+
+TEST(ipcpp_broadcast_ring_buffer, read_in_order) {
+  typedef ipcpp::shm::broadcast_ring_buffer<int> ring_type;
+  AlignedMemory memory(ring_type::required_bytes_for(8));
+  ring_type producer(memory.addr(), memory.size);
+  ring_type consumer(memory.addr());
+  EXPECT_EQ(consumer.size(), 8);
+
+  std::uint64_t cursor = consumer.next_index();
+  EXPECT_EQ(consumer.try_read(cursor).error(), std::errc::no_message_available);
+  for (int i = 0; i < 8; ++i) {
+    producer.emplace(i);
+  }
+  for (int i = 0; i < 8; ++i) {
+    auto value = consumer.try_read(cursor);
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(value.value(), i);
+  }
+  EXPECT_EQ(consumer.try_read(cursor).error(), std::errc::no_message_available);
+}
+
+TEST(ipcpp_broadcast_ring_buffer, detect_overrun) {
+  typedef ipcpp::shm::broadcast_ring_buffer<int> ring_type;
+  AlignedMemory memory(ring_type::required_bytes_for(8));
+  ring_type producer(memory.addr(), memory.size);
+  ring_type consumer(memory.addr());
+
+  std::uint64_t cursor = 0;
+  for (int i = 0; i < 20; ++i) {
+    producer.emplace(i);
+  }
+  EXPECT_EQ(consumer.try_read(cursor).error(), std::errc::value_too_large);
+  EXPECT_EQ(cursor, 12);
+  for (int i = 12; i < 20; ++i) {
+    auto value = consumer.try_read(cursor);
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(value.value(), i);
+  }
+}
+
+TEST(ipcpp_broadcast_ring_buffer, concurrent_consumers) {
+  typedef ipcpp::event::shm_notification_memory_layout<Notification, ipcpp::event::shm_atomic_notification_header>
+      layout_type;
+  constexpr std::uint64_t num_notifications = 200000;
+  AlignedMemory memory(layout_type::required_bytes_for(64));
+  layout_type producer(memory.addr(), memory.size);
+
+  std::vector<std::thread> consumers;
+  std::vector<std::uint64_t> num_received(4, 0);
+  std::vector<std::uint64_t> num_lost(4, 0);
+  for (std::size_t c = 0; c < num_received.size(); ++c) {
+    consumers.emplace_back([&, c]() {
+      layout_type consumer(memory.addr());
+      std::uint64_t cursor = 0;
+      while (cursor < num_notifications) {
+        const std::uint64_t expected_id = cursor;
+        auto e_message = consumer.message_buffer.try_read(cursor);
+        if (e_message.has_value()) {
+          const Notification& notification = e_message->message;
+          // never torn: a notification is either read completely or reported as lost
+          ASSERT_EQ(notification.id, expected_id);
+          ASSERT_EQ(notification.checksum, ~notification.id);
+          ++num_received[c];
+        } else if (e_message.error() == std::errc::value_too_large) {
+          num_lost[c] += cursor - expected_id;
+        }
+      }
+    });
+  }
+  for (std::uint64_t i = 0; i < num_notifications; ++i) {
+    producer.message_buffer.emplace(static_cast<std::int64_t>(i), Notification{i, ~i});
+  }
+  for (auto& consumer : consumers) {
+    consumer.join();
+  }
+  for (std::size_t c = 0; c < num_received.size(); ++c) {
+    EXPECT_EQ(num_received[c] + num_lost[c], num_notifications);
+  }
+}
@@ -0,0 +1,113 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/shm/mapped_memory.h>
+#include <ipcpp/utils/utils.h>
+
+#include <cstring>
+#include <filesystem>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using ipcpp::AccessMode;
+using ipcpp::shm::HugePages;
+using ipcpp::shm::MappedMemory;
+using ipcpp::shm::MappingType;
+using ipcpp::shm::MemoryLock;
+using ipcpp::shm::NumaPolicy;
+using ipcpp::utils::PageSize;
+
+TEST(ipcpp_shm_mapping_options, align_up_to_pages) {
+  const std::size_t page_size = ipcpp::utils::page_size(PageSize::Regular);
+  const std::size_t huge_page_size = ipcpp::utils::page_size(PageSize::Huge);
+  EXPECT_GE(huge_page_size, page_size);
+  EXPECT_EQ(huge_page_size % page_size, 0);
+
+  EXPECT_EQ(ipcpp::utils::align_up(1, PageSize::Regular), page_size);
+  EXPECT_EQ(ipcpp::utils::align_up(page_size, PageSize::Regular), page_size);
+  EXPECT_EQ(ipcpp::utils::align_up(page_size + 1, PageSize::Regular), 2 * page_size);
+  EXPECT_EQ(ipcpp::utils::align_up(1, PageSize::Huge), huge_page_size);
+}
+
+TEST(ipcpp_shm_mapping_options, huge_pages) {
+  // Explicit falls back to transparent huge pages if no hugetlbfs is mounted or no huge pages are reserved
+  for (const HugePages huge_pages : {HugePages::None, HugePages::Transparent, HugePages::Explicit}) {
+    constexpr std::size_t min_size = 3 * 1024 * 1024;
+    auto created = MappedMemory<MappingType::SINGLE>::create("/ipcpp_test_mapping_options_huge_pages", min_size,
+                                                             {.huge_pages = huge_pages});
+    ASSERT_TRUE(created.has_value());
+    EXPECT_GE(created->size(), min_size);
+    EXPECT_EQ(created->size() % ipcpp::utils::page_size(PageSize::Regular), 0);
+    std::memset(reinterpret_cast<void*>(created->addr()), 0x2a, created->size());
+
+    auto opened = MappedMemory<MappingType::SINGLE>::open("/ipcpp_test_mapping_options_huge_pages");
+    ASSERT_TRUE(opened.has_value());
+    EXPECT_EQ(opened->size(), created->size());
+    EXPECT_EQ(reinterpret_cast<const unsigned char*>(opened->addr())[opened->size() - 1], 0x2a);
+  }
+}
+
+TEST(ipcpp_shm_mapping_options, populate) {
+  constexpr std::size_t min_size = 8 * 1024 * 1024;
+  auto created = MappedMemory<MappingType::SINGLE>::create("/ipcpp_test_mapping_options_populate", min_size,
+                                                           {.populate = true, .populate_threads = 4});
+  ASSERT_TRUE(created.has_value());
+  EXPECT_GE(created->size(), min_size);
+  std::memset(reinterpret_cast<void*>(created->addr()), 0x2a, created->size());
+
+  // populating an initialized segment must not change its data
+  for (const AccessMode access_mode : {AccessMode::READ, AccessMode::WRITE}) {
+    auto opened = MappedMemory<MappingType::SINGLE>::open("/ipcpp_test_mapping_options_populate", access_mode,
+                                                          {.populate = true, .populate_threads = 3});
+    ASSERT_TRUE(opened.has_value());
+    const auto* data = reinterpret_cast<const unsigned char*>(opened->addr());
+    EXPECT_EQ(data[0], 0x2a);
+    EXPECT_EQ(data[opened->size() / 2], 0x2a);
+    EXPECT_EQ(data[opened->size() - 1], 0x2a);
+  }
+}
+
+TEST(ipcpp_shm_mapping_options, lock) {
+  // small enough for the default RLIMIT_MEMLOCK
+  for (const MemoryLock lock : {MemoryLock::Locked, MemoryLock::OnFault}) {
+    auto created = MappedMemory<MappingType::SINGLE>::create("/ipcpp_test_mapping_options_lock", 4096,
+                                                             {.populate = true, .lock = lock});
+    ASSERT_TRUE(created.has_value()) << created.error().message();
+    std::memset(reinterpret_cast<void*>(created->addr()), 0x2a, created->size());
+  }
+}
+
+#ifdef __linux__
+TEST(ipcpp_shm_mapping_options, numa_policy) {
+  if (!std::filesystem::exists("/sys/devices/system/node/node0")) {
+    GTEST_SKIP() << "kernel without numa support";
+  }
+  for (const NumaPolicy policy :
+       {NumaPolicy::Bind, NumaPolicy::Interleave, NumaPolicy::Preferred, NumaPolicy::CallingThreadNode}) {
+    auto created = MappedMemory<MappingType::SINGLE>::create(
+        "/ipcpp_test_mapping_options_numa", 4096, {.populate = true, .numa_policy = policy, .numa_nodes = 0b1});
+    ASSERT_TRUE(created.has_value()) << created.error().message();
+
+    int node = -1;
+    ASSERT_EQ(syscall(SYS_get_mempolicy, &node, nullptr, 0, created->addr(), MPOL_F_NODE | MPOL_F_ADDR), 0);
+    if (policy != NumaPolicy::CallingThreadNode) {
+      EXPECT_EQ(node, 0);
+    }
+  }
+
+  // no node selected
+  auto created = MappedMemory<MappingType::SINGLE>::create("/ipcpp_test_mapping_options_numa", 4096,
+                                                           {.numa_policy = NumaPolicy::Bind, .numa_nodes = 0});
+  ASSERT_FALSE(created.has_value());
+  EXPECT_EQ(created.error().value(), static_cast<int>(ipcpp::shm::error_t::numa_error));
+}
+#endif
@@ -0,0 +1,174 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/shm/fd_server.h>
+#include <ipcpp/shm/mapped_memory.h>
+#include <ipcpp/topic.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+
+using ipcpp::shm::FdServer;
+using ipcpp::shm::MappedMemory;
+using ipcpp::shm::MappingType;
+using ipcpp::shm::shared_memory_file;
+
+using namespace std::chrono_literals;
+
+TEST(ipcpp_shm_memfd, sealed) {
+  auto file = shared_memory_file::create_anonymous("ipcpp_test_memfd_sealed", 100);
+  ASSERT_TRUE(file.has_value());
+  EXPECT_EQ(file->size(), 4096);
+  // peers rely on the size: growing or shrinking the object is not allowed
+  EXPECT_EQ(ftruncate(file->native_handle(), 0), -1);
+  EXPECT_EQ(ftruncate(file->native_handle(), 2 * 4096), -1);
+
+  auto adopted = shared_memory_file::from_native_handle("ipcpp_test_memfd_sealed", dup(file->native_handle()));
+  ASSERT_TRUE(adopted.has_value());
+  EXPECT_EQ(adopted->size(), file->size());
+}
+
+TEST(ipcpp_shm_memfd, fd_server) {
+  auto file = shared_memory_file::create_anonymous("ipcpp_test_memfd_fd_server", 4096);
+  ASSERT_TRUE(file.has_value());
+  EXPECT_FALSE(FdServer::receive("ipcpp_test/fd_server").has_value());
+
+  auto server = FdServer::create("ipcpp_test/fd_server", file->native_handle());
+  ASSERT_TRUE(server.has_value());
+  EXPECT_TRUE(server->is_serving());
+  auto second = FdServer::create("ipcpp_test/fd_server", file->native_handle());
+  ASSERT_FALSE(second.has_value());
+  EXPECT_EQ(second.error(), std::errc::address_in_use);
+
+  auto standby = FdServer::standby("ipcpp_test/fd_server", file->native_handle());
+  ASSERT_TRUE(standby.has_value());
+  EXPECT_FALSE(standby->is_serving());
+
+  auto handle = FdServer::receive("ipcpp_test/fd_server");
+  ASSERT_TRUE(handle.has_value());
+  auto received = shared_memory_file::from_native_handle("ipcpp_test_memfd_fd_server", handle.value());
+  ASSERT_TRUE(received.has_value());
+  EXPECT_EQ(received->size(), file->size());
+
+  // the standby server takes over once the serving one is gone
+  server = std::unexpected(std::make_error_code(std::errc::not_connected));
+  const auto deadline = std::chrono::steady_clock::now() + 1s;
+  while (!standby->is_serving() && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_TRUE(standby->is_serving());
+  EXPECT_TRUE(FdServer::receive("ipcpp_test/fd_server").has_value());
+}
+
+TEST(ipcpp_shm_memfd, registry_entry) {
+  EXPECT_FALSE(ipcpp::get_memfd_entry("ipcpp_test_memfd_entry").has_value());
+
+  auto entry = ipcpp::get_memfd_entry("ipcpp_test_memfd_entry", 4096);
+  ASSERT_TRUE(entry.has_value());
+  std::memset(reinterpret_cast<void*>(entry.value()->shm().addr()), 0x2a, entry.value()->shm().size());
+
+  // a process without the entry in its registry receives the handle from this one
+  const pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    auto handle = FdServer::receive(ipcpp::ShmRegistryEntry::memfd_name("ipcpp_test_memfd_entry"));
+    if (!handle.has_value()) {
+      _exit(1);
+    }
+    auto file = shared_memory_file::from_native_handle("ipcpp_test_memfd_entry", handle.value());
+    if (!file.has_value()) {
+      _exit(2);
+    }
+    auto mm = MappedMemory<MappingType::SINGLE>::open(std::move(file.value()));
+    if (!mm.has_value()) {
+      _exit(3);
+    }
+    auto* data = reinterpret_cast<unsigned char*>(mm->addr());
+    if (data[0] != 0x2a || data[mm->size() - 1] != 0x2a) {
+      _exit(4);
+    }
+    data[0] = 0x2b;
+    _exit(0);
+  }
+  int status = 0;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  ASSERT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+  EXPECT_EQ(reinterpret_cast<const unsigned char*>(entry.value()->shm().addr())[0], 0x2b);
+}
+
+TEST(ipcpp_shm_memfd, takeover_on_exit) {
+  const std::string name = ipcpp::ShmRegistryEntry::memfd_name("ipcpp_test_memfd_takeover");
+  int created[2];
+  int joined[2];
+  ASSERT_EQ(pipe(created), 0);
+  ASSERT_EQ(pipe(joined), 0);
+  char byte = 0;
+
+  // the creating process serves the object until the holder joined
+  const pid_t creator = fork();
+  ASSERT_NE(creator, -1);
+  if (creator == 0) {
+    auto entry = ipcpp::get_memfd_entry("ipcpp_test_memfd_takeover", 4096);
+    if (!entry.has_value()) {
+      _exit(1);
+    }
+    reinterpret_cast<unsigned char*>(entry.value()->shm().addr())[0] = 0x2a;
+    if (write(created[1], &byte, 1) != 1 || read(joined[0], &byte, 1) != 1) {
+      _exit(2);
+    }
+    _exit(0);
+  }
+  ASSERT_EQ(read(created[0], &byte, 1), 1);
+  auto handle = FdServer::receive(name);
+  ASSERT_TRUE(handle.has_value());
+  auto file = shared_memory_file::from_native_handle("ipcpp_test_memfd_takeover", handle.value());
+  ASSERT_TRUE(file.has_value());
+  auto holder = FdServer::standby(name, file->native_handle());
+  ASSERT_TRUE(holder.has_value());
+  auto mm = MappedMemory<MappingType::SINGLE>::open(std::move(file.value()));
+  ASSERT_TRUE(mm.has_value());
+  auto* data = reinterpret_cast<unsigned char*>(mm->addr());
+  ASSERT_EQ(data[0], 0x2a);
+  EXPECT_FALSE(holder->is_serving());
+
+  ASSERT_EQ(write(joined[1], &byte, 1), 1);
+  int status = 0;
+  ASSERT_EQ(waitpid(creator, &status, 0), creator);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+
+  // joins right after the serving process exited: it must get the held object instead of creating another one
+  const pid_t joiner = fork();
+  ASSERT_NE(joiner, -1);
+  if (joiner == 0) {
+    auto entry = ipcpp::get_memfd_entry("ipcpp_test_memfd_takeover", 4096);
+    if (!entry.has_value()) {
+      _exit(1);
+    }
+    auto* joined_data = reinterpret_cast<unsigned char*>(entry.value()->shm().addr());
+    if (joined_data[0] != 0x2a) {
+      _exit(2);
+    }
+    joined_data[1] = 0x2b;
+    _exit(0);
+  }
+  ASSERT_EQ(waitpid(joiner, &status, 0), joiner);
+  ASSERT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+  EXPECT_EQ(data[1], 0x2b);
+  EXPECT_TRUE(holder->is_serving());
+  for (const int fd : {created[0], created[1], joined[0], joined[1]}) {
+    close(fd);
+  }
+}
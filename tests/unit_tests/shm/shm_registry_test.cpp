@@ -0,0 +1,101 @@
+/**
+ * Copyright 2025, Leon Freist (https://github.com/lfreist)
+ * Author: Leon Freist <freist.leon@gmail.com>
+ *
+ * This file is part of ipcpp.
+ */
+
+#include <gtest/gtest.h>
+#include <ipcpp/shm/fd_server.h>
+#include <ipcpp/topic.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(ipcpp_shm_registry, cached_entries) {
+  auto created = ipcpp::get_shm_entry("ipcpp_test_registry_cached", 4096);
+  ASSERT_TRUE(created.has_value());
+  auto cached = ipcpp::get_shm_entry("ipcpp_test_registry_cached");
+  ASSERT_TRUE(cached.has_value());
+  EXPECT_EQ(created.value(), cached.value());
+  EXPECT_EQ(cached.value()->id(), "ipcpp_test_registry_cached");
+}
+
+TEST(ipcpp_shm_registry, concurrent_get_shm_entry) {
+  constexpr int num_threads = 8;
+  constexpr int num_topics = 32;
+  std::vector<std::vector<std::shared_ptr<ipcpp::ShmRegistryEntry>>> entries(num_threads);
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+      threads.emplace_back([t, &entries] {
+        for (int i = 0; i < num_topics; ++i) {
+          // threads resolve the topics in different orders
+          const int topic = (i + t * 5) % num_topics;
+          auto entry = ipcpp::get_shm_entry(std::format("ipcpp_test_registry_concurrent_{}", topic), 4096);
+          entries[t].push_back(entry.value_or(nullptr));
+        }
+      });
+    }
+  }
+  // every thread got the same entry for a topic
+  for (int t = 0; t < num_threads; ++t) {
+    ASSERT_EQ(entries[t].size(), num_topics);
+    for (int i = 0; i < num_topics; ++i) {
+      const auto& entry = entries[t][i];
+      ASSERT_NE(entry, nullptr);
+      const int topic = (i + t * 5) % num_topics;
+      EXPECT_EQ(entry->id(), std::format("ipcpp_test_registry_concurrent_{}", topic));
+      EXPECT_EQ(entry, entries[0][topic]);
+    }
+  }
+}
+
+TEST(ipcpp_shm_registry, no_lock_files) {
+  auto entry = ipcpp::get_shm_entry("ipcpp_test_registry_lock_files", 4096);
+  ASSERT_TRUE(entry.has_value());
+  // the creation lock is not backed by a file
+  for (const auto& file : std::filesystem::directory_iterator(std::filesystem::temp_directory_path())) {
+    EXPECT_EQ(file.path().filename().string().find("ipcpp_test_registry_lock_files"), std::string::npos);
+  }
+}
+
+TEST(ipcpp_shm_registry, name_lock) {
+  using namespace std::chrono_literals;
+  {
+    auto lock = ipcpp::shm::NameLock::acquire("ipcpp_test_name_lock");
+    ASSERT_TRUE(lock.has_value());
+    auto contended = ipcpp::shm::NameLock::acquire("ipcpp_test_name_lock", 20ms);
+    ASSERT_FALSE(contended.has_value());
+    EXPECT_EQ(contended.error(), std::errc::timed_out);
+  }
+  EXPECT_TRUE(ipcpp::shm::NameLock::acquire("ipcpp_test_name_lock", 20ms).has_value());
+
+  // the lock of a process that exits is released
+  int pipe_fds[2];
+  ASSERT_EQ(pipe(pipe_fds), 0);
+  const pid_t pid = fork();
+  if (pid == 0) {
+    auto lock = ipcpp::shm::NameLock::acquire("ipcpp_test_name_lock");
+    const char ready = lock.has_value() ? 1 : 0;
+    static_cast<void>(write(pipe_fds[1], &ready, 1));
+    std::this_thread::sleep_for(50ms);
+    _exit(0);
+  }
+  char ready = 0;
+  ASSERT_EQ(read(pipe_fds[0], &ready, 1), 1);
+  ASSERT_EQ(ready, 1);
+  EXPECT_FALSE(ipcpp::shm::NameLock::acquire("ipcpp_test_name_lock", 10ms).has_value());
+  EXPECT_TRUE(ipcpp::shm::NameLock::acquire("ipcpp_test_name_lock", 5000ms).has_value());
+  int status = -1;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  close(pipe_fds[0]);
+  close(pipe_fds[1]);
+}